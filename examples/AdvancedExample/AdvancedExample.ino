@@ -181,12 +181,11 @@ void loop() {
   // ========================================
   
   // Display hexadecimal value
-  // Automatically switches to no-decode mode if needed
+  // Works in either mode; A-F are drawn as segment patterns
   display.displayHex(0x1234);  // Display "1234" in hexadecimal
   delay(1500);
   
   // Display binary value (requires 8 digits)
-  display.setMode(MAX7219_MODE_DECODE);
   display.displayBinary(0b10101010);  // Display "10101010" in binary
   delay(1500);
   
@@ -0,0 +1,116 @@
+/*
+  BusBenchmark
+  
+  Measures how many MAX7219 register writes per second the library achieves
+  with different clock half-period settings, and the bus cost of the
+  dithering brightness engine, and reports the results over Serial.
+  
+  Circuit:
+  - MAX7219 DIN pin connected to PC6 (CH32V003) or pin 12 (Arduino)
+  - MAX7219 CLK pin connected to PC5 (CH32V003) or pin 11 (Arduino)
+  - MAX7219 CS pin connected to PC4 (CH32V003) or pin 10 (Arduino)
+  - MAX7219 VCC connected to 5V
+  - MAX7219 GND connected to GND
+  - 7-segment display connected to MAX7219
+  
+  Created: 2025
+  By: Rithik Krisna M
+*/
+
+#include <MAX7219_CH32.h>
+#include <MAX7219_Dimmer.h>
+
+// Number of register writes per measurement
+#define BENCH_WRITES 1000
+
+// Number of dimmer ticks per measurement
+#define BENCH_TICKS 1000
+
+MAX7219 display(PC6, PC5, PC4, 8);  // CH32V003 pins (change to 12, 11, 10 for Arduino)
+MAX7219Dimmer dimmer(display);
+
+// Time BENCH_WRITES register writes and print the rate
+void runBenchmark(uint8_t halfPeriodUs) {
+  display.setClockHalfPeriod(halfPeriodUs);
+#ifdef MAX7219_ENABLE_STATS
+  display.resetStats();
+#endif
+  
+  unsigned long start = micros();
+  for (uint16_t i = 0; i < BENCH_WRITES; i++) {
+    display.setSegments(i & 0x07, (uint8_t)i);  // One register write each
+  }
+  unsigned long elapsed = micros() - start;
+  
+  Serial.print("Half-period ");
+  Serial.print(halfPeriodUs);
+  Serial.print(" us: ");
+  Serial.print(elapsed / BENCH_WRITES);
+  Serial.print(" us/write, ");
+  Serial.print((BENCH_WRITES * 1000000UL) / elapsed);
+  Serial.println(" writes/s");
+  
+#ifdef MAX7219_ENABLE_STATS
+  // Library-side view of the same run (build with -DMAX7219_ENABLE_STATS)
+  MAX7219Stats stats = display.getStats();
+  Serial.print("  bits clocked: ");
+  Serial.print(stats.bitsClocked);
+  Serial.print(", bus time: ");
+  Serial.print(stats.busMicros);
+  Serial.println(" us");
+  display.resetStats();
+#endif
+}
+
+// Time BENCH_TICKS dimmer updates at a level that needs dithering
+void runDimmerBenchmark(uint8_t level) {
+  dimmer.setLevel(level);
+#ifdef MAX7219_ENABLE_STATS
+  display.resetStats();
+#endif
+  
+  unsigned long start = micros();
+  for (uint16_t i = 0; i < BENCH_TICKS; i++) {
+    dimmer.update();  // At most one register write per tick
+  }
+  unsigned long elapsed = micros() - start;
+  
+  Serial.print("Dimmer level ");
+  Serial.print(level);
+  Serial.print(": ");
+  Serial.print(elapsed / BENCH_TICKS);
+  Serial.print(" us/tick");
+#ifdef MAX7219_ENABLE_STATS
+  Serial.print(", ");
+  Serial.print(display.getStats().registerWrites);
+  Serial.print(" writes per ");
+  Serial.print(BENCH_TICKS);
+  Serial.print(" ticks");
+#endif
+  Serial.println();
+}
+
+void setup() {
+  Serial.begin(115200);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  display.setBrightness(8);
+}
+
+void loop() {
+  Serial.println("--- MAX7219 bus benchmark ---");
+  runBenchmark(0);  // Fastest: limited only by port writes
+  runBenchmark(1);  // 1 us half-period (~500 kHz clock)
+  runBenchmark(5);  // Conservative timing for long wires
+  
+  // Restore default timing
+  display.setClockHalfPeriod(MAX7219_CLOCK_HALF_PERIOD_US);
+  
+  runDimmerBenchmark(30);   // Dithers between off and the lowest step
+  runDimmerBenchmark(200);  // Dithers between two mid-range steps
+  runDimmerBenchmark(128);  // Lands on a hardware step: no writes
+  dimmer.setLevel(255);
+  dimmer.update();
+  dimmer.update();
+  display.display("donE");
+  delay(5000);
+}
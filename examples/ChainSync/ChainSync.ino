@@ -0,0 +1,47 @@
+/*
+  ChainSync
+  
+  Drives two daisy-chained MAX7219 chips from one bus and updates them
+  together with a synchronized chain flush: 8 CS windows per frame,
+  whatever the chain length.
+  
+  Circuit:
+  - First MAX7219 DIN pin connected to PC6 (CH32V003) or pin 12 (Arduino)
+  - MAX7219 CLK pins connected to PC5 (CH32V003) or pin 11 (Arduino)
+  - MAX7219 CS pins connected to PC4 (CH32V003) or pin 10 (Arduino)
+  - First MAX7219 DOUT connected to second MAX7219 DIN
+  - MAX7219 VCC connected to 5V
+  - MAX7219 GND connected to GND
+  - 8-digit 7-segment display connected to each MAX7219
+  
+  Created: 2025
+  By: Rithik Krisna M
+*/
+
+#include <MAX7219_CH32.h>
+#include <MAX7219_Chain.h>
+
+#define CHAIN_CHIPS 2
+
+MAX7219BitBang bus(PC6, PC5, PC4);  // CH32V003 pins (change to 12, 11, 10 for Arduino)
+MAX7219Chain chain(bus, CHAIN_CHIPS);
+MAX7219Display left(chain.chip(1), 8);   // Far end of the chain
+MAX7219Display right(chain.chip(0), 8);  // Connected to the microcontroller
+
+long counter = 0;
+
+void setup() {
+  left.begin();
+  right.begin();
+  chain.setSynchronized(true);
+}
+
+void loop() {
+  // Both halves of the reading switch on the same CS edges: no tearing
+  left.display(counter / 1000);
+  right.display(counter % 1000);
+  chain.flush();
+  
+  counter++;
+  delay(50);
+}
@@ -0,0 +1,40 @@
+/*
+  LevelMeter
+  
+  Shows an analog input as a bar graph with peak hold. Each digit holds two
+  steps (left and right vertical segment pairs), so 8 digits give 16 steps.
+  Only the digits whose fill changed are sent, so the bar can be refreshed
+  at a high rate.
+  
+  Circuit:
+  - MAX7219 DIN pin connected to PC6 (CH32V003) or pin 12 (Arduino)
+  - MAX7219 CLK pin connected to PC5 (CH32V003) or pin 11 (Arduino)
+  - MAX7219 CS pin connected to PC4 (CH32V003) or pin 10 (Arduino)
+  - MAX7219 VCC connected to 5V
+  - MAX7219 GND connected to GND
+  - 7-segment display connected to MAX7219
+  - Potentiometer or sensor output connected to A0
+  
+  Created: 2025
+  By: Rithik Krisna M
+*/
+
+#include <MAX7219_CH32.h>
+#include <MAX7219_LevelMeter.h>
+
+MAX7219 display(PC6, PC5, PC4, 8);  // CH32V003 pins (change to 12, 11, 10 for Arduino)
+MAX7219LevelMeter meter(display, 1023);  // Full bar at analogRead() = 1023
+
+void setup() {
+  // The bar is drawn with raw segments, so no-decode mode is required
+  display.begin(MAX7219_MODE_NO_DECODE);
+  display.setBrightness(8);
+  
+  // Hold the peak for 500 ms, then let it fall one step every 40 ms
+  meter.setPeakHold(500, 40);
+}
+
+void loop() {
+  meter.setValue(analogRead(A0));  // Sends only the digits that changed
+  delay(5);                        // ~200 Hz refresh
+}
@@ -0,0 +1,72 @@
+/*
+  LowPower
+  
+  Battery-friendly reading display. Only the digits in use are scanned
+  (with the intensity lowered to keep the brightness), the chip shuts down
+  after 10 seconds without a new reading, and the estimated supply current
+  is reported over Serial.
+  
+  Circuit:
+  - MAX7219 DIN pin connected to PC6 (CH32V003) or pin 12 (Arduino)
+  - MAX7219 CLK pin connected to PC5 (CH32V003) or pin 11 (Arduino)
+  - MAX7219 CS pin connected to PC4 (CH32V003) or pin 10 (Arduino)
+  - MAX7219 VCC connected to 5V
+  - MAX7219 GND connected to GND
+  - 8-digit 7-segment display connected to MAX7219
+  - Potentiometer wiper connected to A0 (reading source)
+  
+  Created: 2025
+  By: Rithik Krisna M
+*/
+
+#include <MAX7219_CH32.h>
+
+// Peak segment current set by RSET on the module, in mA
+#define SEGMENT_CURRENT_MA 40
+
+// Only readings that move by more than this update the display
+#define READING_THRESHOLD 8
+
+MAX7219 display(PC6, PC5, PC4, 8);  // CH32V003 pins (change to 12, 11, 10 for Arduino)
+
+int lastReading = -1000;
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+  display.begin(MAX7219_MODE_DECODE);
+  display.setBrightness(12);
+  
+  // Compare full scanning against low-power scanning for a short value
+  display.display(42);
+  display.update();
+  Serial.print("Full scan: ");
+  Serial.print(display.estimateCurrent(SEGMENT_CURRENT_MA));
+  Serial.println(" uA");
+  
+  display.setLowPower(true);
+  display.update();
+  Serial.print("Low power: ");
+  Serial.print(display.estimateCurrent(SEGMENT_CURRENT_MA));
+  Serial.println(" uA");
+  
+  display.setSleepTimeout(10000);
+}
+
+void loop() {
+  // A new reading changes the display, which also wakes it from sleep
+  int reading = analogRead(A0);
+  if (abs(reading - lastReading) > READING_THRESHOLD) {
+    lastReading = reading;
+    display.display(reading);
+  }
+  
+  display.update();  // Scan limit, sleep timeout and wake-up
+  
+  if (millis() - lastReport >= 2000) {
+    lastReport = millis();
+    Serial.print(display.isAsleep() ? "Asleep: " : "Showing: ");
+    Serial.print(display.estimateCurrent(SEGMENT_CURRENT_MA));
+    Serial.println(" uA");
+  }
+}
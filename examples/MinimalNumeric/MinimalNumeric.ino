@@ -0,0 +1,40 @@
+/*
+  MinimalNumeric
+  
+  Smallest useful configuration of the MAX7219_CH32 library: integers and
+  fixed-point values only. Build it with -DMAX7219_MINIMAL so animations,
+  floating point, text, hex/binary, scrubbing and power management are
+  stripped from the library. It is also the reference sketch for the size
+  report in the README (make -C extras/test size).
+  
+  Circuit:
+  - MAX7219 DIN pin connected to PC6 (CH32V003) or pin 12 (Arduino)
+  - MAX7219 CLK pin connected to PC5 (CH32V003) or pin 11 (Arduino)
+  - MAX7219 CS pin connected to PC4 (CH32V003) or pin 10 (Arduino)
+  - MAX7219 VCC connected to 5V
+  - MAX7219 GND connected to GND
+  - 7-segment display connected to MAX7219
+  
+  Created: 2025
+  By: Rithik Krisna M
+*/
+
+#include <MAX7219_CH32.h>
+
+MAX7219 display(PC6, PC5, PC4, 8);  // CH32V003 pins (change to 12, 11, 10 for Arduino)
+
+long counter = 0;
+
+void setup() {
+  // BCD decode mode: the chip draws the digits, no glyph tables needed
+  display.begin(MAX7219_MODE_DECODE);
+  display.setBrightness(8);
+}
+
+void loop() {
+  display.display(counter);          // Integer
+  delay(500);
+  display.displayFixed(counter, 1);  // Same value with one decimal place
+  delay(500);
+  counter++;
+}
@@ -0,0 +1,48 @@
+/*
+  SerialProtocol
+  
+  Drives the display from a PC or test rig using the compact binary frame
+  protocol of MAX7219Protocol. Frames are parsed byte by byte as they arrive,
+  so loop() stays responsive and no string buffer is needed.
+  
+  Frame format: 0xA5 <command> <length> <payload...>
+  
+  Examples (hex bytes sent from the host):
+  - A5 02 04 D2 04 00 00     -> show 1234
+  - A5 02 05 2E FB FF FF 02  -> show -12.34 (int32 -1234, 2 decimals)
+  - A5 01 03 37 4F 0E        -> raw segments "HEL"
+  - A5 03 01 0F              -> brightness 15
+  - A5 04 01 00              -> display off
+  
+  Circuit:
+  - MAX7219 DIN pin connected to PC6 (CH32V003) or pin 12 (Arduino)
+  - MAX7219 CLK pin connected to PC5 (CH32V003) or pin 11 (Arduino)
+  - MAX7219 CS pin connected to PC4 (CH32V003) or pin 10 (Arduino)
+  - MAX7219 VCC connected to 5V
+  - MAX7219 GND connected to GND
+  - 7-segment display connected to MAX7219
+  
+  Created: 2025
+  By: Rithik Krisna M
+*/
+
+#include <MAX7219_CH32.h>
+#include <MAX7219_Protocol.h>
+
+MAX7219 display(PC6, PC5, PC4, 8);  // CH32V003 pins (change to 12, 11, 10 for Arduino)
+MAX7219Protocol protocol(display);  // Parser bound to the display
+
+void setup() {
+  Serial.begin(115200);
+  
+  // No-decode mode so raw segment frames and numbers both work
+  display.begin(MAX7219_MODE_NO_DECODE);
+  display.setBrightness(8);
+}
+
+void loop() {
+  // Consume whatever bytes have arrived; each one is applied immediately
+  protocol.poll(Serial);
+  
+  // Other work can run here without waiting for complete frames
+}
@@ -0,0 +1,71 @@
+/*
+  Timeline
+  
+  Plays a scripted intro show (text, blinking, numbers, scrolling, fades)
+  with the non-blocking sequencer instead of delay() calls. loop() keeps
+  running during the show: pressing the button skips to the outro, holding
+  it for a second cancels the show.
+  
+  Circuit:
+  - MAX7219 DIN pin connected to PC6 (CH32V003) or pin 12 (Arduino)
+  - MAX7219 CLK pin connected to PC5 (CH32V003) or pin 11 (Arduino)
+  - MAX7219 CS pin connected to PC4 (CH32V003) or pin 10 (Arduino)
+  - MAX7219 VCC connected to 5V
+  - MAX7219 GND connected to GND
+  - 8-digit 7-segment display connected to MAX7219
+  - Push button between PD4 (CH32V003) or pin 2 (Arduino) and GND
+  
+  Created: 2025
+  By: Rithik Krisna M
+*/
+
+#include <MAX7219_CH32.h>
+#include <MAX7219_Timeline.h>
+
+#define BUTTON_PIN PD4  // Change to 2 for Arduino
+
+// Index of the first outro step in the table below
+#define OUTRO_STEP 7
+
+const MAX7219Step show[] = {
+  MAX7219_SHOW_TEXT("HELLO", 1500),     // 0
+  MAX7219_BLINK(3, 250),                // 1
+  MAX7219_SHOW_NUMBER(12345, 1000),     // 2
+  MAX7219_SHOW_NUMBER(-678, 1000),      // 3
+  MAX7219_LOOP(2, 2),                   // 4: numbers twice
+  MAX7219_SCROLL("CH32 MAX7219", 200),  // 5
+  MAX7219_LOOP(0, 0),                   // 6: repeat forever
+  MAX7219_SHOW_TEXT("donE", 1000),      // 7: outro
+  MAX7219_FADE_OUT(80),                 // 8
+  MAX7219_CLEAR(0),                     // 9
+  MAX7219_END()
+};
+
+MAX7219 display(PC6, PC5, PC4, 8);  // CH32V003 pins (change to 12, 11, 10 for Arduino)
+MAX7219Timeline timeline(display);
+
+bool lastPressed = false;
+unsigned long pressStart = 0;
+
+void setup() {
+  pinMode(BUTTON_PIN, INPUT_PULLUP);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  display.setBrightness(8);
+  timeline.start(show, sizeof(show) / sizeof(show[0]));
+}
+
+void loop() {
+  timeline.update();
+  
+  // The button is read on every pass, even in the middle of a blink or fade
+  bool pressed = digitalRead(BUTTON_PIN) == LOW;
+  if (pressed && !lastPressed) {
+    pressStart = millis();
+    if (timeline.getStep() < OUTRO_STEP) timeline.jump(OUTRO_STEP);
+  }
+  if (pressed && timeline.isRunning() && millis() - pressStart > 1000) {
+    timeline.cancel();
+    display.display("StOP");
+  }
+  lastPressed = pressed;
+}
@@ -0,0 +1,106 @@
+/*
+ * Arduino.cpp - Minimal Arduino core for MAX7219_CH32 host tests
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "Arduino.h"
+
+static unsigned long stubMicros = 0;
+static unsigned long stubWrites = 0;
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t, uint8_t) {
+  stubWrites++;
+}
+
+unsigned long stubDigitalWrites() {
+  return stubWrites;
+}
+
+#ifdef STUB_FAST_GPIO
+// Output and set/reset register of four ports
+static volatile uint32_t stubPorts[4][2];
+static unsigned long stubDirectWrites = 0;
+
+StubPortRegister::operator volatile uint32_t*() const {
+  stubDirectWrites++;
+  return reg;
+}
+
+StubPortRegister stubPortRegister(uint8_t port) {
+  StubPortRegister handle = { stubPorts[port & 3] };
+  return handle;
+}
+
+unsigned long stubPortWrites() {
+  return stubDirectWrites;
+}
+#endif
+
+void delay(unsigned long ms) {
+  stubMicros += ms * 1000UL;
+}
+
+void delayMicroseconds(unsigned int us) {
+  stubMicros += us;
+}
+
+unsigned long millis() {
+  return stubMicros / 1000UL;
+}
+
+unsigned long micros() {
+  return stubMicros;
+}
+
+void stubAdvance(unsigned long ms) {
+  stubMicros += ms * 1000UL;
+}
+
+size_t Print::print(unsigned long value, int base) {
+  char buffer[sizeof(unsigned long) * 8 + 1];
+  char* p = &buffer[sizeof(buffer) - 1];
+  *p = '\0';
+  do {
+    uint8_t digit = value % base;
+    *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    value /= base;
+  } while (value);
+  return write(p);
+}
+
+size_t Print::print(long value, int base) {
+  if (value < 0 && base == DEC) {
+    return write((uint8_t)'-') + print((unsigned long)-value, base);
+  }
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(double value, int digits) {
+  // Same rounding as the Arduino cores' printFloat()
+  size_t n = 0;
+  if (value < 0.0) {
+    n += write((uint8_t)'-');
+    value = -value;
+  }
+  double rounding = 0.5;
+  for (int i = 0; i < digits; i++) rounding /= 10.0;
+  value += rounding;
+  
+  unsigned long whole = (unsigned long)value;
+  double remainder = value - (double)whole;
+  n += print(whole);
+  if (digits > 0) n += write((uint8_t)'.');
+  while (digits-- > 0) {
+    remainder *= 10.0;
+    unsigned int digit = (unsigned int)remainder;
+    n += print(digit);
+    remainder -= digit;
+  }
+  return n;
+}
@@ -0,0 +1,102 @@
+/*
+ * Arduino.h - Minimal Arduino core for building MAX7219_CH32 host tests
+ * 
+ * Provides only what the library and the tests use. Time is simulated:
+ * millis()/micros() advance through delay(), delayMicroseconds() and
+ * stubAdvance(), never by themselves. Pin writes are only counted; tests
+ * observe the bus through MAX7219MockTransport.
+ * 
+ * STUB_FAST_GPIO adds STM32-style ports (output register followed by the
+ * set/reset register) so the library builds its direct-write path, with
+ * ARDUINO_ARCH_STM32 defined. Each direct pin write is counted as well.
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef ARDUINO_STUB_H
+#define ARDUINO_STUB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT  0x0
+#define OUTPUT 0x1
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long millis();
+unsigned long micros();
+
+// Move simulated time forward
+void stubAdvance(unsigned long ms);
+
+// Number of digitalWrite() calls so far
+unsigned long stubDigitalWrites();
+
+#ifdef STUB_FAST_GPIO
+// Port register handle; the library converts it to a pointer once per
+// direct pin write, which is where the write is counted
+struct StubPortRegister {
+  volatile uint32_t* reg;
+  operator volatile uint32_t*() const;
+};
+
+StubPortRegister stubPortRegister(uint8_t port);
+
+// Number of direct port writes so far
+unsigned long stubPortWrites();
+
+#define digitalPinToPort(pin)     ((pin) / 16)
+#define digitalPinToBitMask(pin)  ((uint32_t)1 << ((pin) % 16))
+#define portOutputRegister(port)  (stubPortRegister(port))
+#endif
+
+// ========================================
+// Print / Stream
+// ========================================
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char* str) { return write((const uint8_t*)str, strlen(str)); }
+  
+  size_t print(const char* str) { return write(str); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(long value, int base = DEC);
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned long value, int base = DEC);
+  size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(double value, int digits = 2);
+  size_t println() { return write("\r\n"); }  // Like the Arduino cores
+  template <typename T> size_t println(T value) { size_t n = print(value); return n + println(); }
+  template <typename T> size_t println(T value, int base) { size_t n = print(value, base); return n + println(); }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+
+#endif // ARDUINO_STUB_H
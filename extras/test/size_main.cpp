@@ -0,0 +1,73 @@
+/*
+ * size_main.cpp - Links an example sketch on the host for `make size`
+ * 
+ * Built once with SKETCH set to an example and once without (empty
+ * sketch); the difference in code size is what the library and the sketch
+ * add. USE_<group> adds calls that exercise one feature group on top of
+ * the sketch; built again with the group's MAX7219_NO_* flag (which drops
+ * those calls), the difference is what the group costs a sketch that uses
+ * it. Host (x86-64) figures only show relative costs: absolute sizes on
+ * RISC-V, ARM or AVR differ.
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include <Arduino.h>
+
+// CH32V003 pin names used by the examples
+#define PC4 10
+#define PC5 11
+#define PC6 12
+
+#define setup sketchSetup
+#define loop sketchLoop
+
+#ifdef SKETCH
+#include SKETCH
+#else
+void setup() {}
+void loop() {}
+#endif
+
+int main() {
+  setup();
+  loop();
+  
+#if defined(USE_ANIMATIONS) && !defined(MAX7219_NO_ANIMATIONS)
+  display.blink(1, 0);
+  display.fadeIn(0);
+  display.fadeOut(0);
+  display.chase(0);
+  display.countUp(0, 9, 0);
+  display.countDown(9, 0, 0);
+#endif
+#if defined(USE_FLOAT) && !defined(MAX7219_NO_FLOAT)
+  display.display(3.14159, 3);
+#endif
+#if defined(USE_TEXT) && !defined(MAX7219_NO_TEXT)
+  display.display("HELLO");
+#endif
+#if defined(USE_HEXBIN) && !defined(MAX7219_NO_HEXBIN)
+  display.displayHex(0xBEEFUL);
+  display.displayBinary(0xA5);
+#endif
+  // Scrubbing and power management run inside update(), which stays
+  // callable with their flags set
+#if defined(USE_SCRUB)
+#ifndef MAX7219_NO_SCRUB
+  display.setScrubRate(1);
+#endif
+  display.update();
+#endif
+#if defined(USE_POWER)
+#ifndef MAX7219_NO_POWER
+  display.setLowPower(true);
+  display.setSleepTimeout(60000);
+#endif
+  display.update();
+#endif
+  return 0;
+}
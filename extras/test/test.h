@@ -0,0 +1,150 @@
+/*
+ * test.h - Assertions and display helpers for MAX7219_CH32 host tests
+ * 
+ * Each test_*.cpp is one program: it calls its test functions from main()
+ * and returns testResult(). A failed CHECK prints the location and keeps
+ * going, so one run reports every failure.
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef MAX7219_TEST_H
+#define MAX7219_TEST_H
+
+#include <stdio.h>
+#include <string.h>
+#include "MAX7219_CH32.h"
+
+static int testChecks = 0;
+static int testFailures = 0;
+
+#define CHECK(cond) do { \
+    testChecks++; \
+    if (!(cond)) { \
+      testFailures++; \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    } \
+  } while (0)
+
+#define CHECK_EQ(actual, expected) do { \
+    long a_ = (long)(actual), e_ = (long)(expected); \
+    testChecks++; \
+    if (a_ != e_) { \
+      testFailures++; \
+      printf("%s:%d: %s == %ld, expected %ld\n", __FILE__, __LINE__, #actual, a_, e_); \
+    } \
+  } while (0)
+
+#define CHECK_TEXT(mock, digits, expected) do { \
+    char t_[17]; \
+    testChecks++; \
+    shownText(mock, digits, t_); \
+    if (strcmp(t_, expected) != 0) { \
+      testFailures++; \
+      printf("%s:%d: display shows \"%s\", expected \"%s\"\n", __FILE__, __LINE__, t_, expected); \
+    } \
+  } while (0)
+
+// ========================================
+// Simulated Chip
+// ========================================
+// Reads a register image back as text, the way a viewer would see the
+// digits (leftmost = highest digit register with the default wiring).
+// BCD digits use Code B; raw digits are matched against known glyphs and
+// show as '?' otherwise. A lit decimal point adds a '.' after its digit.
+
+static char glyphChar(uint8_t value, bool decode) {
+  if (decode) return "0123456789-EHLP "[value & 0x0F];
+  static const struct { uint8_t segments; char c; } glyphs[] = {
+    {0x7E, '0'}, {0x30, '1'}, {0x6D, '2'}, {0x79, '3'}, {0x33, '4'},
+    {0x5B, '5'}, {0x5F, '6'}, {0x70, '7'}, {0x7F, '8'}, {0x7B, '9'},
+    {0x77, 'A'}, {0x1F, 'b'}, {0x4E, 'C'}, {0x3D, 'd'}, {0x4F, 'E'},
+    {0x47, 'F'}, {0x37, 'H'}, {0x0E, 'L'}, {0x00, ' '}, {0x01, '-'},
+    {0x67, 'P'}, {0x05, 'r'}, {0x0F, 't'}, {0x3E, 'U'}, {0x15, 'n'},
+    {0x1D, 'o'}, {0x08, '_'}
+  };
+  for (uint8_t i = 0; i < sizeof(glyphs) / sizeof(glyphs[0]); i++) {
+    if (glyphs[i].segments == (value & 0x7F)) return glyphs[i].c;
+  }
+  return '?';
+}
+
+// Text of one chip given its registers (reg[0x01..0x08] digits, reg[0x09] decode)
+static void registersText(const uint8_t* reg, uint8_t numDigits, char* out) {
+  for (int8_t d = numDigits - 1; d >= 0; d--) {
+    uint8_t value = reg[MAX7219_REG_DIGIT0 + d];
+    *out++ = glyphChar(value, (reg[MAX7219_REG_DECODE] >> d) & 1);
+    if (value & 0x80) *out++ = '.';
+  }
+  *out = '\0';
+}
+
+static void shownText(MAX7219MockTransport& mock, uint8_t numDigits, char* out) {
+  uint8_t reg[16];
+  for (uint8_t a = 0; a < 16; a++) reg[a] = mock.registerValue(a);
+  registersText(reg, numDigits, out);
+}
+
+// Daisy chain of chips behind one bus: each transfer() pushes the words
+// already in the chain one chip further, and latch() loads every chip from
+// its shift register (chip 0 = nearest the bus, holds the last word)
+class SimulatedChain : public MAX7219Transport {
+public:
+  SimulatedChain(uint8_t chips) : _chips(chips), _words(0), _latches(0) {
+    memset(_shift, 0, sizeof(_shift));
+    memset(_registers, 0, sizeof(_registers));
+  }
+  
+  virtual void begin() {}
+  virtual void select() {}
+  virtual void transfer(uint8_t address, uint8_t data) {
+    for (uint8_t c = _chips - 1; c > 0; c--) _shift[c] = _shift[c - 1];
+    _shift[0] = ((uint16_t)address << 8) | data;
+    _words++;
+  }
+  virtual void latch() {
+    _latches++;
+    for (uint8_t c = 0; c < _chips; c++) {
+      uint8_t address = (_shift[c] >> 8) & 0x0F;
+      if (address != MAX7219_REG_NOOP) _registers[c][address] = _shift[c] & 0xFF;
+    }
+  }
+  
+  uint16_t words() { return _words; }
+  uint16_t latches() { return _latches; }
+  uint8_t registerValue(uint8_t chip, uint8_t address) { return _registers[chip][address & 0x0F]; }
+  void clearLog() { _words = 0; _latches = 0; }
+  
+private:
+  uint8_t _chips;
+  uint16_t _shift[8];
+  uint8_t _registers[8][16];
+  uint16_t _words;
+  uint16_t _latches;
+};
+
+static void shownText(SimulatedChain& chain, uint8_t chip, uint8_t numDigits, char* out) {
+  uint8_t reg[16];
+  for (uint8_t a = 0; a < 16; a++) reg[a] = chain.registerValue(chip, a);
+  registersText(reg, numDigits, out);
+}
+
+#define CHECK_CHIP_TEXT(chain, chip, digits, expected) do { \
+    char t_[17]; \
+    testChecks++; \
+    shownText(chain, chip, digits, t_); \
+    if (strcmp(t_, expected) != 0) { \
+      testFailures++; \
+      printf("%s:%d: chip %d shows \"%s\", expected \"%s\"\n", __FILE__, __LINE__, chip, t_, expected); \
+    } \
+  } while (0)
+
+static int testResult() {
+  printf("%d checks, %d failed\n", testChecks, testFailures);
+  return testFailures ? 1 : 0;
+}
+
+#endif // MAX7219_TEST_H
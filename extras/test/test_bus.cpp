@@ -0,0 +1,90 @@
+/*
+ * test_bus.cpp - Bit-bang bus cost per register write
+ *
+ * Built twice: test_bus uses the digitalWrite() path, test_bus_fast the
+ * direct port writes (STUB_FAST_GPIO, ARDUINO_ARCH_STM32). Both move the
+ * same pin edges; the report shows how each path makes them.
+ *
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+
+#ifdef STUB_FAST_GPIO
+#define PATH_NAME "direct port writes"
+static unsigned long portWrites() { return stubPortWrites(); }
+#else
+#define PATH_NAME "digitalWrite()"
+static unsigned long portWrites() { return 0; }
+#endif
+
+// Pin writes and delay of one register write on a bus
+struct BusCost {
+  unsigned long digitalWrites;
+  unsigned long portWrites;
+  unsigned long delayMicros;
+};
+
+static BusCost registerWriteCost(MAX7219BitBang& bus) {
+  unsigned long calls = stubDigitalWrites();
+  unsigned long stores = portWrites();
+  unsigned long start = micros();
+  bus.select();
+  bus.transfer(MAX7219_REG_INTENSITY, 0x05);
+  bus.latch();
+  BusCost cost = {
+    stubDigitalWrites() - calls,
+    portWrites() - stores,
+    micros() - start
+  };
+  return cost;
+}
+
+static void testPinWrites() {
+  // CS low, 16 x (DIN, CLK high, CLK low), CS high
+  MAX7219BitBang bus(3, 4, 5);
+  bus.begin();
+  BusCost cost = registerWriteCost(bus);
+
+  CHECK_EQ(cost.digitalWrites + cost.portWrites, 50);
+  CHECK_EQ(cost.delayMicros, 0);
+#if MAX7219_FAST_GPIO
+  CHECK_EQ(cost.digitalWrites, 0);
+#else
+  CHECK_EQ(cost.portWrites, 0);
+#endif
+  printf("%s: %lu digitalWrite() calls, %lu port stores, %lu us delay per register write\n",
+         PATH_NAME, cost.digitalWrites, cost.portWrites, cost.delayMicros);
+}
+
+static void testHalfPeriod() {
+  // One pause per edge: 2 per bit plus one after CS rises
+  MAX7219BitBang bus(3, 4, 5);
+  bus.begin();
+  bus.setClockHalfPeriod(2);
+  BusCost cost = registerWriteCost(bus);
+
+  CHECK_EQ(cost.digitalWrites + cost.portWrites, 50);
+  CHECK_EQ(cost.delayMicros, 33 * 2);
+}
+
+static void testDisplayWrite() {
+  // The pin class adds no bus traffic of its own to a register write
+  MAX7219 display(3, 4, 5, 8);
+  display.begin();
+  unsigned long calls = stubDigitalWrites();
+  unsigned long stores = portWrites();
+  display.setBrightness(3);
+
+  CHECK_EQ((stubDigitalWrites() - calls) + (portWrites() - stores), 50);
+}
+
+int main() {
+  testPinWrites();
+  testHalfPeriod();
+  testDisplayWrite();
+  return testResult();
+}
@@ -0,0 +1,132 @@
+/*
+ * test_chain.cpp - Daisy-chain addressing and synchronized flush tests
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+#include "MAX7219_Chain.h"
+
+static void testPulseCount(uint8_t chips) {
+  // A full frame is 8 CS windows whatever the chain length, each carrying
+  // one word per chip
+  MAX7219MockTransport mock;
+  MAX7219Chain chain(mock, chips);
+  MAX7219Display* displays[MAX7219_CHAIN_MAX_CHIPS];
+  for (uint8_t c = 0; c < chips; c++) {
+    displays[c] = new MAX7219Display(chain.chip(c), 8);
+    displays[c]->begin();
+  }
+  
+  chain.setSynchronized(true);
+  mock.clearLog();
+  for (uint8_t c = 0; c < chips; c++) {
+    displays[c]->display(12345678L + c);
+  }
+  CHECK_EQ(mock.count(), 0);  // Nothing sent before flush()
+  
+  chain.flush();
+  CHECK_EQ(mock.latches(), 8);
+  CHECK_EQ(mock.count(), 8 * chips);
+  
+  // Nothing left to send
+  mock.clearLog();
+  chain.flush();
+  CHECK_EQ(mock.count(), 0);
+  
+  for (uint8_t c = 0; c < chips; c++) delete displays[c];
+}
+
+static void testImmediateWrites() {
+  SimulatedChain bus(3);
+  MAX7219Chain chain(bus, 3);
+  MAX7219Display first(chain.chip(0), 8);
+  MAX7219Display last(chain.chip(2), 8);
+  first.begin();
+  last.begin();
+  
+  // One window per register write, NOOP for the other chips
+  bus.clearLog();
+  last.setBrightness(3);
+  CHECK_EQ(bus.latches(), 1);
+  CHECK_EQ(bus.words(), 3);
+  CHECK_EQ(bus.registerValue(2, MAX7219_REG_INTENSITY), 3);
+  CHECK_EQ(bus.registerValue(0, MAX7219_REG_INTENSITY), 8);
+  CHECK_EQ(bus.registerValue(1, MAX7219_REG_INTENSITY), 0);  // No display on chip 1
+  
+  first.display(1234L);
+  last.display(5678L);
+  CHECK_CHIP_TEXT(bus, 0, 8, "    1234");
+  CHECK_CHIP_TEXT(bus, 2, 8, "    5678");
+}
+
+static void testSynchronizedFrame() {
+  SimulatedChain bus(2);
+  MAX7219Chain chain(bus, 2);
+  MAX7219Display left(chain.chip(1), 8);
+  MAX7219Display right(chain.chip(0), 8);
+  left.begin();
+  right.begin();
+  chain.setSynchronized(true);
+  
+  left.display(12L);
+  right.display(345L);
+  CHECK_CHIP_TEXT(bus, 1, 8, "        ");
+  CHECK_CHIP_TEXT(bus, 0, 8, "        ");
+  
+  chain.flush();
+  CHECK_CHIP_TEXT(bus, 1, 8, "      12");
+  CHECK_CHIP_TEXT(bus, 0, 8, "     345");
+  
+  // Turning synchronization off flushes what is pending
+  right.display(6L);
+  chain.setSynchronized(false);
+  CHECK_CHIP_TEXT(bus, 0, 8, "       6");
+}
+
+static void testSynchronizedDecode() {
+  // Switching to raw glyphs must not reach the chip before the glyphs do
+  SimulatedChain bus(2);
+  MAX7219Chain chain(bus, 2);
+  MAX7219Display first(chain.chip(0), 4);
+  MAX7219Display second(chain.chip(1), 4);
+  first.begin(MAX7219_MODE_DECODE);
+  second.begin(MAX7219_MODE_DECODE);
+  first.setAlignment(MAX7219_ALIGN_LEFT);
+  first.display(1234L);
+  chain.setSynchronized(true);
+  
+  bus.clearLog();
+  first.displayHex(0xBEEF);
+  CHECK_EQ(bus.words(), 0);
+  CHECK_EQ(bus.registerValue(0, MAX7219_REG_DECODE), MAX7219_MODE_DECODE);
+  
+  // DECODE window first (NOOP for the other chip), then the 4 digit rows
+  chain.flush();
+  CHECK_EQ(bus.latches(), 1 + 4);
+  CHECK_EQ(bus.words(), 2 * (1 + 4));
+  CHECK_EQ(bus.registerValue(0, MAX7219_REG_DECODE), MAX7219_MODE_NO_DECODE);
+  CHECK_EQ(bus.registerValue(1, MAX7219_REG_DECODE), MAX7219_MODE_DECODE);
+  CHECK_CHIP_TEXT(bus, 0, 4, "bEEF");
+  
+  // Back to decoded digits, again in one frame
+  bus.clearLog();
+  first.display(42L);
+  CHECK_EQ(bus.words(), 0);
+  chain.flush();
+  CHECK_EQ(bus.registerValue(0, MAX7219_REG_DECODE), MAX7219_MODE_DECODE);
+  CHECK_CHIP_TEXT(bus, 0, 4, "42  ");
+}
+
+int main() {
+  testPulseCount(2);
+  testPulseCount(3);
+  testPulseCount(4);
+  testImmediateWrites();
+  testSynchronizedFrame();
+  testSynchronizedDecode();
+  return testResult();
+}
@@ -0,0 +1,93 @@
+/*
+ * test_dimmer.cpp - Brightness engine tests
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+#include "MAX7219_Dimmer.h"
+
+static void testFullScale() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  MAX7219Dimmer dimmer(display);
+  display.begin();
+  
+  // Maximum level is the top hardware step, held steady
+  dimmer.setLevel(255);
+  dimmer.update();
+  dimmer.update();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 15);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x01);
+  
+  mock.clearLog();
+  for (uint8_t i = 0; i < 64; i++) dimmer.update();
+  CHECK_EQ(mock.count(), 0);
+}
+
+static void testOff() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  MAX7219Dimmer dimmer(display);
+  display.begin();
+  
+  dimmer.setLevel(0);
+  dimmer.update();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x00);
+  
+  mock.clearLog();
+  for (uint8_t i = 0; i < 64; i++) dimmer.update();
+  CHECK_EQ(mock.count(), 0);
+}
+
+static void testDither() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  MAX7219Dimmer dimmer(display);
+  display.begin();
+  
+  // Between two hardware steps: at most one register write per update(),
+  // alternating between the neighbouring intensities
+  dimmer.setLevel(200);
+  for (uint8_t i = 0; i < 4; i++) dimmer.update();  // Power state settles first
+  mock.clearLog();
+  for (uint8_t i = 0; i < 32; i++) {
+    uint16_t before = mock.count();
+    dimmer.update();
+    CHECK(mock.count() - before <= 1);
+  }
+  CHECK(mock.count() > 0);
+  for (uint16_t i = 0; i < mock.count(); i++) {
+    CHECK_EQ(mock.address(i), MAX7219_REG_INTENSITY);
+    CHECK(mock.data(i) == 8 || mock.data(i) == 9);
+  }
+}
+
+static void testFade() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  MAX7219Dimmer dimmer(display);
+  display.begin();
+  
+  dimmer.setLevel(0);
+  dimmer.fadeTo(255, 1000);
+  CHECK(dimmer.isFading());
+  stubAdvance(500);
+  dimmer.update();
+  CHECK(dimmer.getLevel() > 100 && dimmer.getLevel() < 155);
+  stubAdvance(500);
+  dimmer.update();
+  CHECK(!dimmer.isFading());
+  CHECK_EQ(dimmer.getLevel(), 255);
+}
+
+int main() {
+  testFullScale();
+  testOff();
+  testDither();
+  testFade();
+  return testResult();
+}
@@ -0,0 +1,225 @@
+/*
+ * test_display.cpp - Rendering and animation tests on the mock transport
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+
+static void testBegin() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin();
+  
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x01);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SCANLIMIT), 3);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DECODE), MAX7219_MODE_DECODE);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 8);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DISPLAYTEST), 0x00);
+  CHECK_TEXT(mock, 4, "    ");
+  // Every register write is its own CS window
+  CHECK_EQ(mock.latches(), mock.count());
+}
+
+static void testPinConstructor() {
+  // Only the pin variant carries a bit-bang bus
+  CHECK(sizeof(MAX7219) > sizeof(MAX7219Display));
+  
+  MAX7219 display(12, 11, 10, 4);
+  display.setClockHalfPeriod(2);
+  unsigned long start = micros();
+  display.begin();
+  // Two pauses per bit of every begin() write, on top of the 10 ms power-up delay
+  CHECK(micros() - start > 10000UL + 16 * 2 * 2);
+}
+
+static void testNumbers() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin();
+  
+  display.display(1234L);
+  CHECK_TEXT(mock, 8, "    1234");
+  display.display(-42L);
+  CHECK_TEXT(mock, 8, "-     42");
+  display.display(0L);
+  CHECK_TEXT(mock, 8, "       0");
+  display.display(12345678L);
+  CHECK_TEXT(mock, 8, "12345678");
+  display.display(-1234567L);
+  CHECK_TEXT(mock, 8, "-1234567");
+  
+  display.displayFixed(1234, 2);
+  CHECK_TEXT(mock, 8, "    12.34");
+  display.displayFixed(5, 2);
+  CHECK_TEXT(mock, 8, "     0.05");
+  display.displayFixed(-505, 1);
+  CHECK_TEXT(mock, 8, "-    50.5");
+  display.display(3.14159, 2);
+  CHECK_TEXT(mock, 8, "     3.14");
+  
+  display.setAlignment(MAX7219_ALIGN_LEFT);
+  display.display(1234L);
+  CHECK_TEXT(mock, 8, "1234    ");
+  display.setAlignment(MAX7219_ALIGN_CENTER);
+  display.display(1234L);
+  CHECK_TEXT(mock, 8, "  1234  ");
+}
+
+static void testText() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  display.setAlignment(MAX7219_ALIGN_LEFT);
+  
+  display.display("HELP");
+  CHECK_TEXT(mock, 8, "HELP    ");
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DECODE), 0x00);
+}
+
+static void testHex() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  display.setAlignment(MAX7219_ALIGN_LEFT);
+  
+  display.displayHex(0x1A2F);
+  CHECK_TEXT(mock, 8, "    1A2F");
+  
+  // Only the changed nibble is written
+  mock.clearLog();
+  display.displayHex(0x1A2E);
+  CHECK_TEXT(mock, 8, "    1A2E");
+  CHECK_EQ(mock.count(), 1);
+  
+  display.displayBinary(0xA5);
+  CHECK_TEXT(mock, 8, "10100101");
+}
+
+static void testHexInDecodeMode() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_DECODE);
+  display.setAlignment(MAX7219_ALIGN_LEFT);
+  
+  // Hex glyphs switch the decode register off, clear() switches it back
+  display.displayHex(0xBEEF);
+  CHECK_TEXT(mock, 8, "    bEEF");
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DECODE), 0x00);
+  display.clear();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DECODE), MAX7219_MODE_DECODE);
+  display.display(42L);
+  CHECK_TEXT(mock, 8, "42      ");
+}
+
+static void testDigitOrder() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin();
+  
+  // DIGIT0 wired to the leftmost digit
+  const uint8_t reversed[4] = {0, 1, 2, 3};
+  display.setDigitOrder(reversed);
+  display.display(1234L);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 0), 1);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 3), 4);
+  
+  // Not permutations: ignored, the previous wiring stays
+  const uint8_t duplicate[4] = {0, 0, 1, 2};
+  const uint8_t outOfRange[4] = {0, 1, 2, 4};
+  display.setDigitOrder(duplicate);
+  display.setDigitOrder(outOfRange);
+  display.display(5678L);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 0), 5);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 3), 8);
+  
+  // NULL restores the standard wiring
+  display.setDigitOrder(0);
+  display.display(1234L);
+  CHECK_TEXT(mock, 4, "1234");
+}
+
+static void testBlink() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin();
+  display.display(12L);
+  
+  mock.clearLog();
+  unsigned long start = millis();
+  display.blink(2, 100);
+  CHECK_EQ(millis() - start, 400);
+  CHECK_EQ(mock.count(), 4);
+  for (uint8_t i = 0; i < mock.count(); i++) {
+    CHECK_EQ(mock.address(i), MAX7219_REG_SHUTDOWN);
+    CHECK_EQ(mock.data(i), i & 1);
+  }
+  CHECK_TEXT(mock, 4, "  12");
+}
+
+static void testFade() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin();
+  display.setBrightness(8);
+  
+  // Down from the current level to 0, then back to it
+  mock.clearLog();
+  display.fadeOut(10);
+  CHECK_EQ(mock.count(), 10);
+  for (uint8_t i = 0; i <= 8; i++) {
+    CHECK_EQ(mock.address(i), MAX7219_REG_INTENSITY);
+    CHECK_EQ(mock.data(i), 8 - i);
+  }
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 8);
+  
+  // Up through every level, then back to the current one
+  mock.clearLog();
+  display.fadeIn(10);
+  CHECK_EQ(mock.count(), 17);
+  for (uint8_t i = 0; i < 16; i++) {
+    CHECK_EQ(mock.data(i), i);
+  }
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 8);
+}
+
+static void testCount() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin();
+  
+  display.countUp(8, 11, 10);
+  CHECK_TEXT(mock, 4, "  11");
+  display.countDown(3, 0, 10);
+  CHECK_TEXT(mock, 4, "   0");
+}
+
+static void testScroll() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  
+  // The text crosses the display one digit per frame and leaves it blank
+  unsigned long start = millis();
+  display.scroll("HI", 100);
+  CHECK_EQ(millis() - start, 600);
+  CHECK_TEXT(mock, 4, "    ");
+}
+
+int main() {
+  testBegin();
+  testPinConstructor();
+  testNumbers();
+  testText();
+  testHex();
+  testHexInDecodeMode();
+  testDigitOrder();
+  testBlink();
+  testFade();
+  testCount();
+  testScroll();
+  return testResult();
+}
@@ -0,0 +1,81 @@
+/*
+ * test_level_meter.cpp - Level meter bar and peak decay tests
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+#include "MAX7219_LevelMeter.h"
+
+static void testBar() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  MAX7219LevelMeter meter(display, 80);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  
+  // 8 steps over 4 digits: two vertical segment pairs per digit
+  meter.setValue(30);
+  CHECK_EQ(meter.getLevel(), 3);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 3), 0x36);  // Leftmost digit full
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 2), 0x06);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 1), 0x00);
+  
+  // Only the digit holding the moving end is rewritten
+  mock.clearLog();
+  meter.setValue(40);
+  CHECK_EQ(mock.count(), 1);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 2), 0x36);
+}
+
+static void testPeakDecay() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  MAX7219LevelMeter meter(display, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  meter.setPeakHold(500, 10);
+  
+  meter.setValue(8);
+  meter.setValue(0);
+  CHECK_EQ(meter.getPeak(), 8);
+  
+  // Still holding
+  stubAdvance(499);
+  meter.update();
+  CHECK_EQ(meter.getPeak(), 8);
+  
+  // One step per 10 ms after the hold, partial intervals carried over
+  stubAdvance(16);
+  meter.update();
+  CHECK_EQ(meter.getPeak(), 7);
+  stubAdvance(5);
+  meter.update();
+  CHECK_EQ(meter.getPeak(), 6);
+}
+
+static void testLateUpdate() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  MAX7219LevelMeter meter(display, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  meter.setPeakHold(500, 10);
+  
+  meter.setValue(8);
+  meter.setValue(2);
+  
+  // 2570 ms owes 257 steps after the hold, more than a uint8_t can count:
+  // the peak must fall all the way to the bar
+  stubAdvance(500 + 2570);
+  meter.update();
+  CHECK_EQ(meter.getPeak(), 2);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 0), 0x00);  // Rightmost digit dark
+}
+
+int main() {
+  testBar();
+  testPeakDecay();
+  testLateUpdate();
+  return testResult();
+}
@@ -0,0 +1,54 @@
+/*
+ * test_minimal.cpp - Numeric-only build (MAX7219_MINIMAL)
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+
+#ifndef MAX7219_NO_POWER
+#error "MAX7219_MINIMAL must strip power management"
+#endif
+#ifndef MAX7219_NO_SCRUB
+#error "MAX7219_MINIMAL must strip scrubbing"
+#endif
+
+static void testNumeric() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin();
+  
+  display.display(-42L);
+  CHECK_TEXT(mock, 8, "-     42");
+  display.displayFixed(1234, 2);
+  CHECK_TEXT(mock, 8, "    12.34");
+  
+  display.setBrightness(5);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 5);
+  display.setPower(false);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x00);
+  display.setPower(true);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x01);
+}
+
+static void testUpdateIsIdle() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin();
+  
+  mock.clearLog();
+  for (uint8_t i = 0; i < 20; i++) {
+    display.update();
+    stubAdvance(1000);
+  }
+  CHECK_EQ(mock.count(), 0);
+}
+
+int main() {
+  testNumeric();
+  testUpdateIsIdle();
+  return testResult();
+}
@@ -0,0 +1,213 @@
+/*
+ * test_power.cpp - Scrubbing, sleep and wake tests on the mock transport
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+
+static void testScrubCycle() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin();
+  display.display(1234L);
+  display.setScrubRate(1);
+  
+  // One register per update(): 5 control registers, then the 8 digits
+  mock.clearLog();
+  for (uint8_t i = 0; i < 13; i++) display.update();
+  CHECK_EQ(mock.count(), 13);
+  CHECK_EQ(mock.address(0), MAX7219_REG_DECODE);
+  CHECK_EQ(mock.address(5), MAX7219_REG_DIGIT0);
+  CHECK_EQ(mock.address(12), MAX7219_REG_DIGIT0 + 7);
+  CHECK_TEXT(mock, 8, "    1234");
+}
+
+static void testNoScrubWhileAsleep() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin();
+  display.display(1234L);
+  display.setScrubRate(2);
+  display.update();
+  
+  display.sleep();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x00);
+  
+  // The bus stays idle until the display wakes
+  mock.clearLog();
+  for (uint8_t i = 0; i < 20; i++) display.update();
+  CHECK_EQ(mock.count(), 0);
+  CHECK(display.isAsleep());
+  
+  display.wake();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x01);
+  mock.clearLog();
+  display.update();
+  CHECK_EQ(mock.count(), 2);
+}
+
+static void testSleepTimeout() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin();
+  display.setScrubRate(1);
+  display.setSleepTimeout(1000);
+  display.update();
+  
+  stubAdvance(1000);
+  display.update();
+  CHECK(display.isAsleep());
+  
+  // New content wakes the display
+  mock.clearLog();
+  stubAdvance(10);
+  display.update();
+  CHECK_EQ(mock.count(), 0);
+  display.display(42L);
+  display.update();
+  CHECK(!display.isAsleep());
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x01);
+  CHECK_TEXT(mock, 8, "      42");
+}
+
+static void testScrubKeepsRawGlyphs() {
+  // Hex digits are raw glyphs in no-decode; replaying them must not switch
+  // their digits back to Code B
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin(MAX7219_MODE_DECODE);
+  display.setAlignment(MAX7219_ALIGN_LEFT);
+  display.displayHex(0x1A2B);
+  CHECK_TEXT(mock, 4, "1A2b");
+  
+  display.setScrubRate(1);
+  for (uint8_t i = 0; i < 2 * (5 + 4); i++) display.update();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DECODE), MAX7219_MODE_NO_DECODE);
+  CHECK_TEXT(mock, 4, "1A2b");
+  
+  // Overwriting a digit still restores the mode's decoding for it
+  display.displayAt(0, (uint8_t)5);
+  uint8_t decode = mock.registerValue(MAX7219_REG_DECODE);
+  CHECK(decode != MAX7219_MODE_NO_DECODE && (decode & (decode - 1)) == 0);
+}
+
+static void testWakeKeepsRawGlyphs() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin(MAX7219_MODE_DECODE);
+  display.setAlignment(MAX7219_ALIGN_LEFT);
+  display.displayHex(0x1A2B);
+  
+  display.sleep();
+  display.wake();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DECODE), MAX7219_MODE_NO_DECODE);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x01);
+  CHECK_TEXT(mock, 4, "1A2b");
+}
+
+static void testLowPowerScan() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin();
+  display.display(42L);
+  display.setLowPower(true);
+  
+  // Shrinking: dim first, then scan fewer digits. I' = (17 * 2 - 8) / 16
+  mock.clearLog();
+  display.update();
+  CHECK_EQ(mock.count(), 2);
+  CHECK_EQ(mock.address(0), MAX7219_REG_INTENSITY);
+  CHECK_EQ(mock.data(0), 1);
+  CHECK_EQ(mock.address(1), MAX7219_REG_SCANLIMIT);
+  CHECK_EQ(mock.data(1), 1);
+  
+  // Nothing to do while the content keeps its width
+  display.display(17L);
+  mock.clearLog();
+  display.update();
+  CHECK_EQ(mock.count(), 0);
+  
+  // Growing: scan more digits first, then brighten. I' = (17 * 5 - 8) / 16
+  display.display(12345L);
+  mock.clearLog();
+  display.update();
+  CHECK_EQ(mock.count(), 2);
+  CHECK_EQ(mock.address(0), MAX7219_REG_SCANLIMIT);
+  CHECK_EQ(mock.data(0), 4);
+  CHECK_EQ(mock.address(1), MAX7219_REG_INTENSITY);
+  CHECK_EQ(mock.data(1), 4);
+  CHECK_TEXT(mock, 8, "   12345");
+  
+  // Turning it off restores the full scan at once
+  display.setLowPower(false);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SCANLIMIT), 7);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 8);
+}
+
+static void testLowPowerNeverBrighter() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin();
+  display.setBrightness(2);
+  display.display(7L);
+  
+  // 3 segments, (2 * 2 + 1) / 32 of 1/8 of the time at 40 mA
+  CHECK_EQ(display.estimateCurrent(), 8000UL + 40000UL * 3 * 5 / 256);
+  uint32_t fullScan = display.estimateCurrent();
+  
+  // One digit would need intensity 5/8 - 1/2 < 0: scan two at intensity 0
+  display.setLowPower(true);
+  display.update();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SCANLIMIT), 1);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 0);
+  CHECK_EQ(display.estimateCurrent(), 8000UL + 40000UL * 3 * 1 / 64);
+  CHECK(display.estimateCurrent() < fullScan);
+  
+  // Lowering the brightness widens the scan with it
+  mock.clearLog();
+  display.setBrightness(0);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SCANLIMIT), 7);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 0);
+  CHECK_EQ(mock.address(0), MAX7219_REG_SCANLIMIT);
+  
+  // At full brightness a single digit is enough
+  display.setBrightness(15);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SCANLIMIT), 0);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 1);
+  CHECK_EQ(display.estimateCurrent(), 8000UL + 40000UL * 3 * 3 / 32);
+}
+
+static void testCurrentEstimate() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin();
+  
+  // Blank display: quiescent current only
+  CHECK_EQ(display.estimateCurrent(), MAX7219_OPERATING_CURRENT_UA);
+  
+  // "8." lights all 8 segments; intensity 8 is 17/32 duty, over 4 digits
+  display.displayAt(3, (uint8_t)8, true);
+  CHECK_EQ(display.estimateCurrent(20), 8000UL + 20000UL * 8 * 17 / 128);
+  
+  display.setPower(false);
+  CHECK_EQ(display.estimateCurrent(), MAX7219_SHUTDOWN_CURRENT_UA);
+  display.setPower(true);
+  display.sleep();
+  CHECK_EQ(display.estimateCurrent(), MAX7219_SHUTDOWN_CURRENT_UA);
+}
+
+int main() {
+  testScrubCycle();
+  testNoScrubWhileAsleep();
+  testSleepTimeout();
+  testScrubKeepsRawGlyphs();
+  testWakeKeepsRawGlyphs();
+  testLowPowerScan();
+  testLowPowerNeverBrighter();
+  testCurrentEstimate();
+  return testResult();
+}
@@ -0,0 +1,141 @@
+/*
+ * test_print.cpp - Print adapter tests on the mock transport
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+#include <limits.h>
+#include "MAX7219_Print.h"
+
+static void testAlignment() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Print out(display);
+  
+  out.println(42);
+  CHECK_TEXT(mock, 8, "      42");
+  
+  display.setAlignment(MAX7219_ALIGN_LEFT);
+  out.println(42);
+  CHECK_TEXT(mock, 8, "42      ");
+  
+  display.setAlignment(MAX7219_ALIGN_CENTER);
+  out.println(42);
+  CHECK_TEXT(mock, 8, "   42   ");
+  
+  // Nothing is shown before the end of the line
+  mock.clearLog();
+  out.print("t ");
+  out.print(23);
+  CHECK_EQ(mock.count(), 0);
+  out.println();
+  CHECK_TEXT(mock, 8, "  t 23  ");
+}
+
+static void testDecimalPoints() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Print out(display);
+  
+  // The point shares the digit before it
+  out.println(-3.14159, 3);
+  CHECK_TEXT(mock, 8, "   -3.142");
+  
+  // A point with no digit of its own before it gets a blank digit
+  out.println(".5");
+  CHECK_TEXT(mock, 8, "       .5");
+  out.println("1..2");
+  CHECK_TEXT(mock, 8, "     1. .2");
+}
+
+static void testLineEndings() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Print out(display);
+  
+  // println() ends lines with "\r\n"; '\r' alone neither shows nor clears
+  out.print("1\r2\r\n");
+  CHECK_TEXT(mock, 4, "  12");
+  out.print("7\n");
+  CHECK_TEXT(mock, 4, "   7");
+  
+  // An empty line blanks the display
+  out.println();
+  CHECK_TEXT(mock, 4, "    ");
+}
+
+static void testDecodeMode() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_DECODE);
+  MAX7219Print out(display);
+  
+  // Digits stay Code B
+  out.println(-12.5, 1);
+  CHECK_TEXT(mock, 8, "    -12.5");
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DECODE), MAX7219_MODE_DECODE);
+  
+  // Hex letters are drawn as segment patterns
+  out.println(255, HEX);
+  CHECK_TEXT(mock, 8, "      FF");
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DECODE), MAX7219_MODE_NO_DECODE);
+  out.println(0xBEEFUL, HEX);
+  CHECK_TEXT(mock, 8, "    bEEF");
+  
+  // And back to decoding for the next number
+  out.println(42);
+  CHECK_TEXT(mock, 8, "      42");
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DECODE), MAX7219_MODE_DECODE);
+}
+
+static void testOverflow() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Print out(display);
+  
+  // A cut-off value would be wrong: show dashes
+  out.println(123456789L);
+  CHECK_TEXT(mock, 8, "--------");
+  out.println(12345678L);
+  CHECK_TEXT(mock, 8, "12345678");
+  
+  // Longer than this display but within the line buffer
+  MAX7219MockTransport small;
+  MAX7219Display four(small, 4);
+  four.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Print outFour(four);
+  outFour.println(12345);
+  CHECK_TEXT(small, 4, "----");
+  outFour.println(1.5, 2);
+  CHECK_TEXT(small, 4, " 1.50");
+}
+
+static void testScrollLong() {
+  // Every digit of a 64-bit long fits the conversion buffer
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  display.setAlignment(MAX7219_ALIGN_LEFT);
+  display.scroll(LONG_MIN, 0);
+  CHECK_TEXT(mock, 8, "        ");
+  display.scroll(-1234L, 0);
+  CHECK_TEXT(mock, 8, "        ");
+}
+
+int main() {
+  testAlignment();
+  testDecimalPoints();
+  testLineEndings();
+  testDecodeMode();
+  testOverflow();
+  testScrollLong();
+  return testResult();
+}
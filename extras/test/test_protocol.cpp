@@ -0,0 +1,172 @@
+/*
+ * test_protocol.cpp - Serial protocol tests on recorded byte streams
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+#include "MAX7219_Protocol.h"
+
+// Replays a recorded byte stream, as if it had arrived on a serial port
+class RecordedStream : public Stream {
+public:
+  RecordedStream(const uint8_t* bytes, size_t length) : _bytes(bytes), _length(length), _pos(0) {}
+  
+  virtual int available() { return _length - _pos; }
+  virtual int read() { return (_pos < _length) ? _bytes[_pos++] : -1; }
+  virtual int peek() { return (_pos < _length) ? _bytes[_pos] : -1; }
+  virtual size_t write(uint8_t) { return 0; }
+  
+private:
+  const uint8_t* _bytes;
+  size_t _length;
+  size_t _pos;
+};
+
+#define REPLAY(protocol, bytes) replay(protocol, bytes, sizeof(bytes))
+
+static uint8_t replay(MAX7219Protocol& protocol, const uint8_t* bytes, size_t length) {
+  RecordedStream stream(bytes, length);
+  return protocol.poll(stream);
+}
+
+static void testExampleFrames() {
+  // The frames listed in the SerialProtocol example
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  MAX7219Protocol protocol(display);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  
+  const uint8_t number[] = {0xA5, 0x02, 0x04, 0xD2, 0x04, 0x00, 0x00};
+  CHECK_EQ(REPLAY(protocol, number), 1);
+  CHECK_TEXT(mock, 8, "    1234");
+  
+  const uint8_t fixed[] = {0xA5, 0x02, 0x05, 0x2E, 0xFB, 0xFF, 0xFF, 0x02};
+  CHECK_EQ(REPLAY(protocol, fixed), 1);
+  CHECK_TEXT(mock, 8, "-   12.34");
+  
+  // Raw segments from position 0 (rightmost); other digits keep their content
+  const uint8_t segments[] = {0xA5, 0x01, 0x03, 0x37, 0x4F, 0x0E};
+  CHECK_EQ(REPLAY(protocol, segments), 1);
+  CHECK_TEXT(mock, 8, "-   1LEH");
+  
+  const uint8_t brightnessAndPower[] = {0xA5, 0x03, 0x01, 0x0F, 0xA5, 0x04, 0x01, 0x00};
+  CHECK_EQ(REPLAY(protocol, brightnessAndPower), 2);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 15);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x00);
+}
+
+static void testSegmentsInDecodeMode() {
+  // Segment bytes must not be read as BCD: 0x37 0x4F 0x0E would show "P 7"
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  MAX7219Protocol protocol(display);
+  display.begin(MAX7219_MODE_DECODE);
+  display.display(12345678L);
+  
+  const uint8_t segments[] = {0xA5, 0x01, 0x03, 0x37, 0x4F, 0x0E};
+  CHECK_EQ(REPLAY(protocol, segments), 1);
+  CHECK_TEXT(mock, 8, "12345LEH");
+  
+  // Only the three touched digits left decoding
+  uint8_t decode = mock.registerValue(MAX7219_REG_DECODE);
+  CHECK_EQ(decode & 0xF8, 0xF8);
+  CHECK_EQ(decode & 0x07, 0x00);
+  
+  // A number frame puts every digit back to Code B
+  const uint8_t number[] = {0xA5, 0x02, 0x04, 0x07, 0x00, 0x00, 0x00};
+  CHECK_EQ(REPLAY(protocol, number), 1);
+  CHECK_TEXT(mock, 8, "       7");
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DECODE), MAX7219_MODE_DECODE);
+}
+
+static void testFixedPoint() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  MAX7219Protocol protocol(display);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  
+  // 5 with 2 decimals is padded to a leading zero
+  const uint8_t small[] = {0xA5, 0x02, 0x05, 0x05, 0x00, 0x00, 0x00, 0x02};
+  CHECK_EQ(REPLAY(protocol, small), 1);
+  CHECK_TEXT(mock, 8, "     0.05");
+  
+  // 0 decimals: no decimal point
+  const uint8_t whole[] = {0xA5, 0x02, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00};
+  CHECK_EQ(REPLAY(protocol, whole), 1);
+  CHECK_TEXT(mock, 8, "       7");
+}
+
+static void testShortNumberFrame() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  MAX7219Protocol protocol(display);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  display.display(42L);
+  
+  // 2-byte NUMBER frame: consumed but not applied
+  mock.clearLog();
+  const uint8_t shortFrame[] = {0xA5, 0x02, 0x02, 0xD2, 0x04};
+  CHECK_EQ(REPLAY(protocol, shortFrame), 1);
+  CHECK_EQ(mock.count(), 0);
+  CHECK_TEXT(mock, 8, "      42");
+  
+  // The parser is back in sync for the next frame
+  const uint8_t next[] = {0xA5, 0x02, 0x04, 0x09, 0x00, 0x00, 0x00};
+  CHECK_EQ(REPLAY(protocol, next), 1);
+  CHECK_TEXT(mock, 8, "       9");
+}
+
+static void testDroppedByte() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  MAX7219Protocol protocol(display);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  display.setBrightness(8);
+  
+  // NUMBER 1234 lost its last byte: the brightness frame's sync byte
+  // completes it, and the rest of that frame is skipped until the next sync
+  const uint8_t stream[] = {
+    0xA5, 0x02, 0x04, 0xD2, 0x04, 0x00,  // Dropped 0x00
+    0xA5, 0x03, 0x01, 0x0F,              // Swallowed
+    0xA5, 0x02, 0x04, 0x39, 0x30, 0x00, 0x00
+  };
+  CHECK_EQ(REPLAY(protocol, stream), 2);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 8);
+  CHECK_TEXT(mock, 8, "   12345");
+  
+  // reset() drops a partial frame, so the next one is applied intact
+  const uint8_t partial[] = {0xA5, 0x02, 0x04, 0xD2};
+  CHECK_EQ(REPLAY(protocol, partial), 0);
+  protocol.reset();
+  const uint8_t brightness[] = {0xA5, 0x03, 0x01, 0x0F};
+  CHECK_EQ(REPLAY(protocol, brightness), 1);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 15);
+  CHECK_TEXT(mock, 8, "   12345");
+}
+
+static void testUnknownCommand() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  MAX7219Protocol protocol(display);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  
+  // Payload of an unknown command may contain the sync byte
+  mock.clearLog();
+  const uint8_t stream[] = {0xA5, 0x7F, 0x02, 0xA5, 0x03, 0xA5, 0x02, 0x04, 0x01, 0x00, 0x00, 0x00};
+  CHECK_EQ(REPLAY(protocol, stream), 2);
+  CHECK_TEXT(mock, 8, "       1");
+}
+
+int main() {
+  testExampleFrames();
+  testSegmentsInDecodeMode();
+  testFixedPoint();
+  testShortNumberFrame();
+  testDroppedByte();
+  testUnknownCommand();
+  return testResult();
+}
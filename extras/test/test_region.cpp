@@ -0,0 +1,160 @@
+/*
+ * test_region.cpp - Display region tests on the mock transport
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+#include "MAX7219_Region.h"
+
+static void testSideBySide() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Region label(display, 0, 2, MAX7219_ALIGN_LEFT);
+  MAX7219Region value(display, 2, 6);
+  
+  label.show("t");
+  value.show(1234L);
+  CHECK_TEXT(mock, 8, "t   1234");
+  
+  // Only the changed digit of the value is sent
+  mock.clearLog();
+  value.show(1235L);
+  CHECK_EQ(mock.count(), 1);
+  CHECK_EQ(mock.address(0), MAX7219_REG_DIGIT0);
+  CHECK_TEXT(mock, 8, "t   1235");
+  
+  // Neither region touches the other's registers
+  mock.clearLog();
+  label.show("H");
+  value.show(98765L);
+  for (uint16_t i = 0; i < mock.count(); i++) {
+    if (mock.address(i) >= MAX7219_REG_DIGIT0 + 6) {
+      CHECK(i < 1);  // Label digits: the first write only
+    } else {
+      CHECK(i >= 1);
+    }
+  }
+  CHECK_TEXT(mock, 8, "H  98765");
+  
+  // Nothing changed, nothing sent
+  mock.clearLog();
+  value.show(98765L);
+  label.show("H");
+  CHECK_EQ(mock.count(), 0);
+  
+  value.clear();
+  CHECK_TEXT(mock, 8, "H       ");
+}
+
+static void testOverflow() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Region region(display, 5, 3);
+  display.display("AB");
+  
+  region.show(999L);
+  CHECK_TEXT(mock, 8, "     999");
+  region.show(1000L);
+  CHECK_TEXT(mock, 8, "     ---");
+  region.show(-99L);
+  CHECK_TEXT(mock, 8, "     -99");
+  region.show(-100L);
+  CHECK_TEXT(mock, 8, "     ---");
+  
+  // Text is cut to the region instead
+  region.show("HELLO");
+  CHECK_TEXT(mock, 8, "     HEL");
+}
+
+static void testFormat() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_DECODE);
+  MAX7219Region region(display, 2, 6);
+  
+  region.setFormat(2);
+  region.show(1234L);
+  CHECK_TEXT(mock, 8, "    12.34");
+  region.show(5L);
+  CHECK_TEXT(mock, 8, "     0.05");
+  region.show(-5L);
+  CHECK_TEXT(mock, 8, "    -0.05");
+  
+  // Zero padding leaves room for the sign
+  region.setFormat(0, true);
+  region.show(42L);
+  CHECK_TEXT(mock, 8, "  000042");
+  region.show(-42L);
+  CHECK_TEXT(mock, 8, "  -00042");
+  
+  region.setFormat(2, true);
+  region.show(-5L);
+  CHECK_TEXT(mock, 8, "  -000.05");
+  
+  // Padding never drops the digits the decimals need
+  MAX7219MockTransport small;
+  MAX7219Display four(small, 4);
+  four.begin(MAX7219_MODE_DECODE);
+  MAX7219Region narrow(four, 0, 4);
+  narrow.setFormat(3, true);
+  narrow.show(5L);
+  CHECK_TEXT(small, 4, "0.005");
+  narrow.show(-5L);
+  CHECK_TEXT(small, 4, "----");
+}
+
+static void testAlignment() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_DECODE);
+  MAX7219Region region(display, 2, 4);
+  
+  region.show(7L);
+  CHECK_TEXT(mock, 8, "     7  ");
+  region.setAlignment(MAX7219_ALIGN_LEFT);
+  region.show(7L);
+  CHECK_TEXT(mock, 8, "  7     ");
+  region.setAlignment(MAX7219_ALIGN_CENTER);
+  region.show(7L);
+  CHECK_TEXT(mock, 8, "   7    ");
+  region.show(12L);
+  CHECK_TEXT(mock, 8, "   12   ");
+}
+
+static void testDigitOrder() {
+  // Module with DIGIT0 on the leftmost column
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 4);
+  display.begin(MAX7219_MODE_DECODE);
+  const uint8_t reversed[4] = {0, 1, 2, 3};
+  display.setDigitOrder(reversed);
+  
+  MAX7219Region left(display, 0, 2);
+  MAX7219Region right(display, 2, 2);
+  left.show(12L);
+  right.show(34L);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 0), 1);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 1), 2);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 2), 3);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_DIGIT0 + 3), 4);
+  
+  mock.clearLog();
+  right.show(35L);
+  CHECK_EQ(mock.count(), 1);
+  CHECK_EQ(mock.address(0), MAX7219_REG_DIGIT0 + 3);
+}
+
+int main() {
+  testSideBySide();
+  testOverflow();
+  testFormat();
+  testAlignment();
+  testDigitOrder();
+  return testResult();
+}
@@ -0,0 +1,71 @@
+/*
+ * test_stats.cpp - Bus usage counters (MAX7219_ENABLE_STATS)
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+#include "MAX7219_Chain.h"
+
+static void testSingleChip() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin();
+  display.resetStats();
+  
+  display.setBrightness(3);
+  MAX7219Stats stats = display.getStats();
+  CHECK_EQ(stats.registerWrites, 1);
+  CHECK_EQ(stats.bitsClocked, 16);
+}
+
+static void testChainPadding() {
+  // Addressing one chip of three shifts 48 bits: its word and two NOOPs
+  MAX7219MockTransport mock;
+  MAX7219Chain chain(mock, 3);
+  MAX7219Display display(chain.chip(1), 8);
+  display.begin();
+  display.resetStats();
+  chain.resetStats();
+  
+  display.setBrightness(3);
+  CHECK_EQ(display.getStats().registerWrites, 1);
+  CHECK_EQ(display.getStats().bitsClocked, 48);
+  CHECK_EQ(chain.getBitsClocked(), 48);
+}
+
+static void testChainFlush() {
+  MAX7219MockTransport mock;
+  MAX7219Chain chain(mock, 3);
+  MAX7219Display displays[3] = {
+    MAX7219Display(chain.chip(0), 8),
+    MAX7219Display(chain.chip(1), 8),
+    MAX7219Display(chain.chip(2), 8)
+  };
+  for (uint8_t c = 0; c < 3; c++) {
+    displays[c].begin();
+    displays[c].resetStats();
+  }
+  chain.setSynchronized(true);
+  chain.resetStats();
+  mock.clearLog();
+  
+  // Buffered digit writes shift nothing; the flush shifts 8 rows of 3 words
+  for (uint8_t c = 0; c < 3; c++) displays[c].display(87654321L);
+  for (uint8_t c = 0; c < 3; c++) CHECK_EQ(displays[c].getStats().bitsClocked, 0);
+  CHECK_EQ(chain.getBitsClocked(), 0);
+  
+  chain.flush();
+  CHECK_EQ(chain.getBitsClocked(), 8 * 3 * 16);
+  CHECK_EQ(mock.count(), 8 * 3);
+}
+
+int main() {
+  testSingleChip();
+  testChainPadding();
+  testChainFlush();
+  return testResult();
+}
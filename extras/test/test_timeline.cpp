@@ -0,0 +1,252 @@
+/*
+ * test_timeline.cpp - Timeline sequencer tests in simulated time
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "test.h"
+#include "MAX7219_Timeline.h"
+
+#define COUNT(steps) (uint8_t)(sizeof(steps) / sizeof(steps[0]))
+
+// Rightmost character shown
+static char lastDigit(MAX7219MockTransport& mock) {
+  char text[17];
+  shownText(mock, 8, text);
+  return text[strlen(text) - 1];
+}
+
+// Plays the timeline in 'stepMs' ticks and records the number on every change
+static void record(MAX7219Timeline& timeline, MAX7219MockTransport& mock, uint16_t stepMs, char* out) {
+  char shown = 0;
+  for (uint16_t tick = 0; tick < 1000 && timeline.isRunning(); tick++) {
+    timeline.update();
+    char c = lastDigit(mock);
+    if (c != shown && timeline.isRunning()) *out++ = c;
+    shown = c;
+    stubAdvance(stepMs);
+  }
+  *out = '\0';
+}
+
+#define CHECK_SEQUENCE(actual, expected) do { \
+    testChecks++; \
+    if (strcmp(actual, expected) != 0) { \
+      testFailures++; \
+      printf("%s:%d: played \"%s\", expected \"%s\"\n", __FILE__, __LINE__, actual, expected); \
+    } \
+  } while (0)
+
+static void testHolds() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Timeline timeline(display);
+  const MAX7219Step steps[] = {
+    MAX7219_SHOW_NUMBER(1, 100),
+    MAX7219_SHOW_NUMBER(2, 100),
+    MAX7219_END(),
+    MAX7219_SHOW_NUMBER(3, 100)
+  };
+  
+  timeline.start(steps, COUNT(steps));
+  timeline.update();
+  CHECK_EQ(lastDigit(mock), '1');
+  stubAdvance(99);
+  timeline.update();
+  CHECK_EQ(lastDigit(mock), '1');
+  stubAdvance(1);
+  timeline.update();
+  CHECK_EQ(lastDigit(mock), '2');
+  CHECK_EQ(timeline.getStep(), 1);
+  stubAdvance(100);
+  timeline.update();
+  CHECK(!timeline.isRunning());
+  CHECK_EQ(lastDigit(mock), '2');
+}
+
+static void testNoDrift() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Timeline timeline(display);
+  const MAX7219Step steps[] = {
+    MAX7219_SHOW_NUMBER(1, 100),
+    MAX7219_SHOW_NUMBER(2, 100),
+    MAX7219_SHOW_NUMBER(3, 100),
+    MAX7219_SHOW_NUMBER(4, 100),
+    MAX7219_SHOW_NUMBER(5, 100)
+  };
+  
+  // update() runs 30 ms late for every step: the show still keeps its beat
+  timeline.start(steps, COUNT(steps));
+  timeline.update();
+  stubAdvance(130);
+  timeline.update();
+  CHECK_EQ(lastDigit(mock), '2');
+  stubAdvance(69);  // 199 ms after the start
+  timeline.update();
+  CHECK_EQ(lastDigit(mock), '2');
+  stubAdvance(1);
+  timeline.update();
+  CHECK_EQ(lastDigit(mock), '3');
+  
+  // More than a whole hold behind: restart the beat from now rather than
+  // skipping frames
+  stubAdvance(350);
+  timeline.update();
+  CHECK_EQ(lastDigit(mock), '4');
+  stubAdvance(99);
+  timeline.update();
+  CHECK_EQ(lastDigit(mock), '4');
+  stubAdvance(1);
+  timeline.update();
+  CHECK_EQ(lastDigit(mock), '5');
+}
+
+static void testLoops() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Timeline timeline(display);
+  char played[64];
+  
+  const MAX7219Step simple[] = {
+    MAX7219_SHOW_NUMBER(1, 10),
+    MAX7219_SHOW_NUMBER(2, 10),
+    MAX7219_LOOP(0, 3),
+    MAX7219_SHOW_NUMBER(9, 10)
+  };
+  timeline.start(simple, COUNT(simple));
+  record(timeline, mock, 10, played);
+  CHECK_SEQUENCE(played, "1212129");
+  
+  // The inner loop plays twice on every pass of the outer one
+  const MAX7219Step nested[] = {
+    MAX7219_SHOW_NUMBER(1, 10),
+    MAX7219_SHOW_NUMBER(2, 10),
+    MAX7219_SHOW_NUMBER(3, 10),
+    MAX7219_LOOP(1, 2),
+    MAX7219_LOOP(0, 2),
+    MAX7219_END()
+  };
+  timeline.start(nested, COUNT(nested));
+  record(timeline, mock, 10, played);
+  CHECK_SEQUENCE(played, "1232312323");
+  
+  // A jump out of a loop body forgets the loop
+  const MAX7219Step jumpOut[] = {
+    MAX7219_SHOW_NUMBER(1, 10),
+    MAX7219_JUMP(3),
+    MAX7219_LOOP(0, 5),
+    MAX7219_SHOW_NUMBER(4, 10),
+    MAX7219_LOOP(3, 2)
+  };
+  timeline.start(jumpOut, COUNT(jumpOut));
+  record(timeline, mock, 10, played);
+  CHECK_SEQUENCE(played, "14");
+}
+
+static void testJump() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Timeline timeline(display);
+  const MAX7219Step steps[] = {
+    MAX7219_SHOW_NUMBER(1, 1000),
+    MAX7219_SHOW_NUMBER(2, 1000),
+    MAX7219_SHOW_NUMBER(3, 1000)
+  };
+  
+  timeline.start(steps, COUNT(steps));
+  timeline.update();
+  stubAdvance(10);
+  timeline.jump(2);
+  timeline.update();
+  CHECK_EQ(lastDigit(mock), '3');
+  CHECK_EQ(timeline.getStep(), 2);
+  
+  // Held for its full time from the jump
+  stubAdvance(999);
+  timeline.update();
+  CHECK(timeline.isRunning());
+  
+  timeline.jump(5);
+  CHECK(!timeline.isRunning());
+  timeline.jump(0);  // Ignored once stopped
+  CHECK(!timeline.isRunning());
+}
+
+static void testCancel() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Timeline timeline(display);
+  
+  // Cancelled while blinked off: power comes back
+  const MAX7219Step blink[] = { MAX7219_BLINK(3, 100) };
+  timeline.start(blink, COUNT(blink));
+  timeline.update();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x00);
+  timeline.cancel();
+  CHECK(!timeline.isRunning());
+  CHECK_EQ(mock.registerValue(MAX7219_REG_SHUTDOWN), 0x01);
+  
+  // Cancelled halfway through a fade: brightness comes back
+  display.setBrightness(8);
+  const MAX7219Step fadeOut[] = { MAX7219_FADE_OUT(10) };
+  timeline.start(fadeOut, COUNT(fadeOut));
+  timeline.update();
+  stubAdvance(10);
+  timeline.update();
+  stubAdvance(10);
+  timeline.update();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 6);
+  timeline.cancel();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 8);
+  
+  // Starting another table also restores them
+  const MAX7219Step fadeIn[] = { MAX7219_FADE_IN(10) };
+  timeline.start(fadeIn, COUNT(fadeIn));
+  timeline.update();
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 0);
+  timeline.start(blink, COUNT(blink));
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 8);
+  timeline.cancel();
+}
+
+static void testStepBudget() {
+  MAX7219MockTransport mock;
+  MAX7219Display display(mock, 8);
+  display.begin(MAX7219_MODE_NO_DECODE);
+  MAX7219Timeline timeline(display);
+  
+  // Loops forever without holding: each update() runs one pass and returns
+  const MAX7219Step spin[] = {
+    MAX7219_SET_BRIGHTNESS(3),
+    MAX7219_SET_BRIGHTNESS(5),
+    MAX7219_LOOP(0, 0)
+  };
+  timeline.start(spin, COUNT(spin));
+  mock.clearLog();
+  timeline.update();
+  CHECK(timeline.isRunning());
+  CHECK_EQ(mock.count(), 2);
+  timeline.update();
+  CHECK_EQ(mock.count(), 4);
+  CHECK_EQ(mock.registerValue(MAX7219_REG_INTENSITY), 5);
+  timeline.cancel();
+}
+
+int main() {
+  testHolds();
+  testNoDrift();
+  testLoops();
+  testJump();
+  testCancel();
+  testStepBudget();
+  return testResult();
+}
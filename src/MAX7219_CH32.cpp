@@ -40,6 +40,7 @@ const uint8_t SEGMENT_DIGITS[10] = {
   0b01111011   // 9
 };
 
+#ifndef MAX7219_NO_TEXT
 // Letter patterns (A-Z)
 const uint8_t SEGMENT_LETTERS[26] = {
   0b01110111,  // A
@@ -69,7 +70,9 @@ const uint8_t SEGMENT_LETTERS[26] = {
   0b00111011,  // y
   0b01101101   // Z
 };
+#endif
 
+#ifndef MAX7219_NO_HEXBIN
 // Hex digits (A-F)
 const uint8_t SEGMENT_HEX[6] = {
   0b01110111,  // A
@@ -79,47 +82,96 @@ const uint8_t SEGMENT_HEX[6] = {
   0b01001111,  // E
   0b01000111   // F
 };
+#endif
+
+// BCD decode (Code B) characters 0x0A-0x0F
+const uint8_t SEGMENT_CODE_B[6] = {
+  0b00000001,  // -
+  0b01001111,  // E
+  0b00110111,  // H
+  0b00001110,  // L
+  0b01100111,  // P
+  0b00000000   // blank
+};
 
 // Special characters
 #define SEGMENT_BLANK   0b00000000
 #define SEGMENT_MINUS   0b00000001
 #define SEGMENT_DOT     0b10000000
 
+// Instrumentation hook; compiles to nothing unless MAX7219_ENABLE_STATS is set
+#ifdef MAX7219_ENABLE_STATS
+#define MAX7219_STAT_ADD(field, n) (_stats.field += (n))
+#else
+#define MAX7219_STAT_ADD(field, n) ((void)0)
+#endif
+
 // ========================================
 // Constructor
 // ========================================
-MAX7219::MAX7219(uint8_t dinPin, uint8_t clkPin, uint8_t csPin, uint8_t numDigits) {
-  _dinPin = dinPin;
-  _clkPin = clkPin;
-  _csPin = csPin;
+MAX7219Display::MAX7219Display(MAX7219Transport& transport, uint8_t numDigits) {
+  _transport = &transport;
+  init(numDigits);
+}
+
+// The base only stores the address of _bitBang, so it may be constructed later
+MAX7219::MAX7219(uint8_t dinPin, uint8_t clkPin, uint8_t csPin, uint8_t numDigits)
+  : MAX7219Display(_bitBang, numDigits), _bitBang(dinPin, clkPin, csPin) {
+}
+
+void MAX7219::setClockHalfPeriod(uint8_t microseconds) {
+  _bitBang.setClockHalfPeriod(microseconds);
+}
+
+void MAX7219Display::init(uint8_t numDigits) {
   _numDigits = constrain(numDigits, 1, 8);
   _mode = MAX7219_MODE_DECODE;
+  _decodeReg = _mode;
   _alignment = MAX7219_ALIGN_RIGHT;
   _brightness = 8;
+  _power = true;
+  memset(_digitCache, 0, sizeof(_digitCache));
+  _scanLimit = _numDigits - 1;
+#ifndef MAX7219_NO_SCRUB
+  _scrubRate = 0;
+  _scrubIndex = 0;
+#endif
+#ifndef MAX7219_NO_POWER
+  _lowPower = false;
+  _asleep = false;
+  _sleepTimeout = 0;
+  _lastChange = 0;
+  memset(_lastFrame, 0, sizeof(_lastFrame));
+#endif
+  standardWiring();
+#ifdef MAX7219_ENABLE_STATS
+  resetStats();
+#endif
 }
 
 // ========================================
 // Initialization
 // ========================================
-void MAX7219::begin() {
+void MAX7219Display::begin() {
   begin(_mode);
 }
 
-void MAX7219::begin(uint8_t mode) {
-  pinMode(_dinPin, OUTPUT);
-  pinMode(_clkPin, OUTPUT);
-  pinMode(_csPin, OUTPUT);
-  
-  digitalWrite(_csPin, HIGH);
-  digitalWrite(_clkPin, LOW);
-  digitalWrite(_dinPin, LOW);
+void MAX7219Display::begin(uint8_t mode) {
+  _transport->begin();
   
   delay(10);
   
   _mode = mode;
+  _power = true;
+  _scanLimit = _numDigits - 1;
+#ifndef MAX7219_NO_POWER
+  _asleep = false;
+  _lastChange = millis();
+#endif
   
   sendCommand(MAX7219_REG_SHUTDOWN, 0x01);           // Normal operation
-  sendCommand(MAX7219_REG_SCANLIMIT, _numDigits - 1); // Set digit count
+  sendCommand(MAX7219_REG_SCANLIMIT, _scanLimit);    // Set digit count
+  _decodeReg = _mode;
   sendCommand(MAX7219_REG_DECODE, _mode);            // Set decode mode
   sendCommand(MAX7219_REG_INTENSITY, _brightness);   // Set brightness
   sendCommand(MAX7219_REG_DISPLAYTEST, 0x00);        // Normal mode
@@ -130,34 +182,160 @@ void MAX7219::begin(uint8_t mode) {
 // ========================================
 // Configuration Functions
 // ========================================
-void MAX7219::setMode(uint8_t mode) {
+void MAX7219Display::setMode(uint8_t mode) {
   _mode = mode;
+  _decodeReg = mode;
   sendCommand(MAX7219_REG_DECODE, mode);
   clear();
 }
 
-uint8_t MAX7219::getMode() {
+uint8_t MAX7219Display::getMode() {
   return _mode;
 }
 
-void MAX7219::setAlignment(uint8_t alignment) {
+void MAX7219Display::setAlignment(uint8_t alignment) {
   _alignment = alignment;
+  buildPositionMap();
 }
 
-uint8_t MAX7219::getAlignment() {
+void MAX7219Display::setDigitOrder(const uint8_t* order) {
+  if (order) {
+    // Must be a permutation: every register in range and used once
+    uint8_t seen = 0;
+    for (uint8_t col = 0; col < _numDigits; col++) {
+      if (order[col] >= _numDigits) return;  // Invalid wiring: keep current map
+      uint8_t bit = 1 << order[col];
+      if (seen & bit) return;
+      seen |= bit;
+    }
+    memcpy(_colMap, order, _numDigits);
+    buildPositionMap();
+  } else {
+    standardWiring();
+  }
+}
+
+uint8_t MAX7219Display::getAlignment() {
   return _alignment;
 }
 
-void MAX7219::setBrightness(uint8_t level) {
+void MAX7219Display::setBrightness(uint8_t level) {
   _brightness = constrain(level, 0, 15);
-  sendCommand(MAX7219_REG_INTENSITY, _brightness);
+#ifndef MAX7219_NO_POWER
+  // A lower brightness may need a wider scan; that rewrites the intensity too
+  if (_lowPower && applyScanLimit()) return;
+#endif
+  sendCommand(MAX7219_REG_INTENSITY, scaledIntensity());
+}
+
+void MAX7219Display::setPower(bool on) {
+  _power = on;
+  sendCommand(MAX7219_REG_SHUTDOWN, shutdownValue());
+}
+
+#ifndef MAX7219_NO_SCRUB
+void MAX7219Display::setScrubRate(uint8_t registersPerUpdate) {
+  _scrubRate = registersPerUpdate;
+}
+#endif
+
+#ifndef MAX7219_NO_POWER
+void MAX7219Display::setLowPower(bool on) {
+  _lowPower = on;
+  if (!on) applyScanLimit();  // Back to the full scan right away
+}
+
+bool MAX7219Display::isLowPower() {
+  return _lowPower;
+}
+
+void MAX7219Display::setSleepTimeout(unsigned long ms) {
+  _sleepTimeout = ms;
+  _lastChange = millis();
+}
+
+void MAX7219Display::sleep() {
+  if (_asleep) return;
+  _asleep = true;
+  sendCommand(MAX7219_REG_SHUTDOWN, 0x00);  // Registers keep their content
+  _transport->idle();
+}
+
+void MAX7219Display::wake() {
+  _asleep = false;
+  _lastChange = millis();
+  
+  // Rewrite everything in case the chip lost its registers while asleep
+  sendCommand(MAX7219_REG_DISPLAYTEST, 0x00);
+  sendCommand(MAX7219_REG_DECODE, _decodeReg);
+  sendCommand(MAX7219_REG_SCANLIMIT, _scanLimit);
+  sendCommand(MAX7219_REG_INTENSITY, scaledIntensity());
+  for (uint8_t i = 0; i < _numDigits; i++) {
+    writeRegister(MAX7219_REG_DIGIT0 + i, _digitCache[i]);  // Cached as shown: keep the decode bits
+  }
+  sendCommand(MAX7219_REG_SHUTDOWN, _power ? 0x01 : 0x00);
+}
+
+bool MAX7219Display::isAsleep() {
+  return _asleep;
+}
+
+uint32_t MAX7219Display::estimateCurrent(uint8_t segmentCurrentMa) {
+  if (_asleep || !_power) return MAX7219_SHUTDOWN_CURRENT_UA;
+  
+  // Lit segments among the scanned digits
+  uint16_t lit = 0;
+  for (uint8_t d = 0; d <= _scanLimit; d++) {
+    for (uint8_t segments = digitGlyph(d); segments; segments &= segments - 1) {
+      lit++;
+    }
+  }
+  
+  // Each digit is driven for 1/(scanLimit+1) of the time, with the segment
+  // PWM on for (2 * intensity + 1)/32 of that
+  uint32_t duty32 = 2 * scaledIntensity() + 1;
+  return MAX7219_OPERATING_CURRENT_UA +
+         (uint32_t)segmentCurrentMa * 1000UL * lit * duty32 / (32UL * (_scanLimit + 1));
 }
+#endif
 
-void MAX7219::setPower(bool on) {
-  sendCommand(MAX7219_REG_SHUTDOWN, on ? 0x01 : 0x00);
+void MAX7219Display::update() {
+#ifndef MAX7219_NO_SCRUB
+  uint8_t scrubWrites = _scrubRate;
+#ifndef MAX7219_NO_POWER
+  // The bus stays parked while asleep; wake() rewrites every register anyway
+  if (_asleep) scrubWrites = 0;
+#endif
+  for (uint8_t i = 0; i < scrubWrites; i++) {
+    scrubNext();
+  }
+#endif
+  
+#ifndef MAX7219_NO_POWER
+  // Any change of the display content since the last call counts as activity
+  if (memcmp(_lastFrame, _digitCache, _numDigits) != 0) {
+    memcpy(_lastFrame, _digitCache, _numDigits);
+    _lastChange = millis();
+    if (_asleep) wake();
+  }
+  
+  if (_asleep) return;
+  
+  if (_lowPower) applyScanLimit();
+  
+  if (_sleepTimeout && (millis() - _lastChange >= _sleepTimeout)) {
+    sleep();
+  }
+#endif
 }
 
-void MAX7219::clear() {
+void MAX7219Display::clear() {
+  // Every digit is rewritten, so restore the mode's decoding in one write
+  if (_decodeReg != _mode) {
+    _decodeReg = _mode;
+    writeRegister(MAX7219_REG_DECODE, _decodeReg);
+  }
+  
   for (uint8_t i = 0; i < _numDigits; i++) {
     if (_mode == MAX7219_MODE_DECODE) {
       sendCommand(MAX7219_REG_DIGIT0 + i, 0x0F);  // Blank in decode mode
@@ -170,7 +348,8 @@ void MAX7219::clear() {
 // ========================================
 // Display Functions (Mode-Aware)
 // ========================================
-void MAX7219::display(const char* text) {
+#ifndef MAX7219_NO_TEXT
+void MAX7219Display::display(const char* text) {
   if (_mode == MAX7219_MODE_DECODE) {
     // In decode mode, try to parse as number
     long num = atol(text);
@@ -180,23 +359,30 @@ void MAX7219::display(const char* text) {
     displayTextInternal(text);
   }
 }
+#endif
 
-void MAX7219::display(int number) {
+void MAX7219Display::display(int number) {
   displayNumberInternal((long)number, false);
 }
 
-void MAX7219::display(long number) {
+void MAX7219Display::display(long number) {
   displayNumberInternal(number, false);
 }
 
-void MAX7219::display(double number, uint8_t decimals) {
+#ifndef MAX7219_NO_FLOAT
+void MAX7219Display::display(double number, uint8_t decimals) {
   displayFloatInternal((float)number, decimals);
 }
+#endif
+
+void MAX7219Display::displayFixed(long value, uint8_t decimals) {
+  displayFixedInternal(value, decimals);
+}
 
-void MAX7219::displayAt(uint8_t position, uint8_t value, bool dp) {
+void MAX7219Display::displayAt(uint8_t position, uint8_t value, bool dp) {
   if (position >= _numDigits) return;
   
-  uint8_t physPos = getPhysicalPosition(position);
+  uint8_t physPos = _posMap[position];
   
   if (_mode == MAX7219_MODE_DECODE) {
     // BCD mode: hardware handles display
@@ -211,34 +397,17 @@ void MAX7219::displayAt(uint8_t position, uint8_t value, bool dp) {
   }
 }
 
-void MAX7219::displayAt(uint8_t position, char character, bool dp) {
+void MAX7219Display::displayAt(uint8_t position, char character, bool dp) {
   if (position >= _numDigits) return;
   
-  uint8_t physPos = getPhysicalPosition(position);
-  
-  if (_mode == MAX7219_MODE_DECODE) {
-    // BCD mode: only supports digits
-    if (character >= '0' && character <= '9') {
-      uint8_t data = character - '0';
-      if (dp) data |= 0x80;
-      sendCommand(MAX7219_REG_DIGIT0 + physPos, data);
-    } else if (character == '-') {
-      sendCommand(MAX7219_REG_DIGIT0 + physPos, 0x0A);
-    } else {
-      sendCommand(MAX7219_REG_DIGIT0 + physPos, 0x0F);  // Blank
-    }
-  } else {
-    // No-decode mode: supports all characters
-    uint8_t segments = charToSegments(character);
-    if (dp) segments |= SEGMENT_DOT;
-    sendCommand(MAX7219_REG_DIGIT0 + physPos, segments);
-  }
+  uint8_t physPos = _posMap[position];
+  sendCommand(MAX7219_REG_DIGIT0 + physPos, encodeChar(character, dp));
 }
 
 // ========================================
 // Special Format Functions
 // ========================================
-void MAX7219::displayTime(uint8_t hours, uint8_t minutes) {
+void MAX7219Display::displayTime(uint8_t hours, uint8_t minutes) {
   if (_numDigits < 4) return;
   
   hours = constrain(hours, 0, 99);
@@ -257,9 +426,10 @@ void MAX7219::displayTime(uint8_t hours, uint8_t minutes) {
   displayAt(startPos + 1, (uint8_t)(hours % 10), true);  // DP as colon
   displayAt(startPos + 2, (uint8_t)(minutes / 10));
   displayAt(startPos + 3, (uint8_t)(minutes % 10));
+  MAX7219_STAT_ADD(framesFlushed, 1);
 }
 
-void MAX7219::displayTime(uint8_t hours, uint8_t minutes, uint8_t seconds) {
+void MAX7219Display::displayTime(uint8_t hours, uint8_t minutes, uint8_t seconds) {
   if (_numDigits < 6) return;
   
   hours = constrain(hours, 0, 99);
@@ -281,48 +451,49 @@ void MAX7219::displayTime(uint8_t hours, uint8_t minutes, uint8_t seconds) {
   displayAt(startPos + 3, (uint8_t)(minutes % 10), true);
   displayAt(startPos + 4, (uint8_t)(seconds / 10));
   displayAt(startPos + 5, (uint8_t)(seconds % 10));
+  MAX7219_STAT_ADD(framesFlushed, 1);
 }
 
-void MAX7219::displayHex(uint32_t value) {
-  if (_mode == MAX7219_MODE_DECODE) {
-    setMode(MAX7219_MODE_NO_DECODE);  // Switch to no-decode for hex
-  }
+#ifndef MAX7219_NO_HEXBIN
+void MAX7219Display::displayHex(uint32_t value) {
+  // Hex digits are drawn as segment patterns whatever the mode
+  useRawGlyphs();
   
+  // Logical position n-1 holds the least significant nibble
+  bool blank = false;
   for (int i = _numDigits - 1; i >= 0; i--) {
-    uint8_t digit = value & 0xF;
-    uint8_t physPos = getPhysicalPosition(i);
-    
-    if (digit < 10) {
-      sendCommand(MAX7219_REG_DIGIT0 + physPos, SEGMENT_DIGITS[digit]);
+    uint8_t segments;
+    if (blank) {
+      segments = SEGMENT_BLANK;  // Leading zero
     } else {
-      sendCommand(MAX7219_REG_DIGIT0 + physPos, SEGMENT_HEX[digit - 10]);
-    }
-    
-    value >>= 4;
-    if (value == 0 && i > 0) {
-      // Clear leading zeros
-      for (int j = i - 1; j >= 0; j--) {
-        uint8_t pos = getPhysicalPosition(j);
-        sendCommand(MAX7219_REG_DIGIT0 + pos, SEGMENT_BLANK);
-      }
-      break;
+      uint8_t digit = value & 0xF;
+      segments = (digit < 10) ? SEGMENT_DIGITS[digit] : SEGMENT_HEX[digit - 10];
+      value >>= 4;
+      blank = (value == 0);
     }
+    writeGlyph(_posMap[i], segments);
   }
+  MAX7219_STAT_ADD(framesFlushed, 1);
 }
 
-void MAX7219::displayBinary(uint8_t value) {
+void MAX7219Display::displayBinary(uint8_t value) {
   if (_numDigits < 8) return;
   
+  useRawGlyphs();
+  
   for (int i = 0; i < 8; i++) {
     uint8_t bit = (value >> (7 - i)) & 1;
-    displayAt(i, bit);
+    writeGlyph(_posMap[i], SEGMENT_DIGITS[bit]);
   }
+  MAX7219_STAT_ADD(framesFlushed, 1);
 }
+#endif
 
+#ifndef MAX7219_NO_ANIMATIONS
 // ========================================
 // Animation Functions
 // ========================================
-void MAX7219::blink(uint8_t times, uint16_t delayMs) {
+void MAX7219Display::blink(uint8_t times, uint16_t delayMs) {
   for (uint8_t i = 0; i < times; i++) {
     setPower(false);
     delay(delayMs);
@@ -331,7 +502,7 @@ void MAX7219::blink(uint8_t times, uint16_t delayMs) {
   }
 }
 
-void MAX7219::fadeIn(uint16_t delayMs) {
+void MAX7219Display::fadeIn(uint16_t delayMs) {
   uint8_t oldBrightness = _brightness;
   for (uint8_t b = 0; b <= 15; b++) {
     setBrightness(b);
@@ -340,7 +511,7 @@ void MAX7219::fadeIn(uint16_t delayMs) {
   setBrightness(oldBrightness);
 }
 
-void MAX7219::fadeOut(uint16_t delayMs) {
+void MAX7219Display::fadeOut(uint16_t delayMs) {
   uint8_t oldBrightness = _brightness;
   for (int b = _brightness; b >= 0; b--) {
     setBrightness(b);
@@ -349,30 +520,33 @@ void MAX7219::fadeOut(uint16_t delayMs) {
   setBrightness(oldBrightness);
 }
 
-void MAX7219::scroll(const char* text, uint16_t delayMs) {
+#ifndef MAX7219_NO_TEXT
+void MAX7219Display::scroll(const char* text, uint16_t delayMs) {
   int len = strlen(text);
   
   for (int offset = _numDigits - 1; offset >= -len; offset--) {
-    clear();
-    
-    for (int i = 0; i < len; i++) {
-      int pos = offset + i;
-      if (pos >= 0 && pos < _numDigits) {
-        displayAt(pos, text[i]);
-      }
-    }
-    
+    scrollFrame(text, len, offset);
     delay(delayMs);
   }
 }
 
-void MAX7219::scroll(long number, uint16_t delayMs) {
-  char buffer[16];
-  sprintf(buffer, "%ld", number);
-  scroll(buffer, delayMs);
+void MAX7219Display::scroll(long number, uint16_t delayMs) {
+  // Convert without sprintf so the printf family is not linked in; room for
+  // the digits of any long (under 3 per byte), the sign and the terminator
+  char buffer[sizeof(long) * 3 + 2];
+  char* p = buffer + sizeof(buffer) - 1;
+  *p = '\0';
+  unsigned long value = (number < 0) ? 0UL - (unsigned long)number : (unsigned long)number;
+  do {
+    *--p = '0' + (value % 10);
+    value /= 10;
+  } while (value > 0);
+  if (number < 0) *--p = '-';
+  scroll(p, delayMs);
 }
+#endif
 
-void MAX7219::chase(uint16_t delayMs) {
+void MAX7219Display::chase(uint16_t delayMs) {
   for (uint8_t i = 0; i < _numDigits; i++) {
     clear();
     displayAt(i, (uint8_t)8);  // Display "8" to light all segments
@@ -386,7 +560,7 @@ void MAX7219::chase(uint16_t delayMs) {
   }
 }
 
-void MAX7219::countUp(long from, long to, uint16_t delayMs) {
+void MAX7219Display::countUp(long from, long to, uint16_t delayMs) {
   if (from > to) return;
   
   for (long i = from; i <= to; i++) {
@@ -395,7 +569,7 @@ void MAX7219::countUp(long from, long to, uint16_t delayMs) {
   }
 }
 
-void MAX7219::countDown(long from, long to, uint16_t delayMs) {
+void MAX7219Display::countDown(long from, long to, uint16_t delayMs) {
   if (from < to) return;
   
   for (long i = from; i >= to; i--) {
@@ -403,69 +577,197 @@ void MAX7219::countDown(long from, long to, uint16_t delayMs) {
     delay(delayMs);
   }
 }
+#endif
 
 // ========================================
 // Low-Level Control
 // ========================================
-void MAX7219::setSegments(uint8_t position, uint8_t segments) {
+void MAX7219Display::setSegments(uint8_t position, uint8_t segments) {
   if (position >= _numDigits) return;
-  uint8_t physPos = getPhysicalPosition(position);
+  uint8_t physPos = _posMap[position];
   sendCommand(MAX7219_REG_DIGIT0 + physPos, segments);
 }
 
-void MAX7219::setRawDigit(uint8_t position, uint8_t value, bool dp) {
+void MAX7219Display::setRawDigit(uint8_t position, uint8_t value, bool dp) {
   if (position >= _numDigits) return;
-  uint8_t physPos = getPhysicalPosition(position);
+  uint8_t physPos = _posMap[position];
   uint8_t data = value;
   if (dp) data |= 0x80;
   sendCommand(MAX7219_REG_DIGIT0 + physPos, data);
 }
 
+#ifdef MAX7219_ENABLE_STATS
+// ========================================
+// Instrumentation
+// ========================================
+MAX7219Stats MAX7219Display::getStats() {
+  return _stats;
+}
+
+void MAX7219Display::resetStats() {
+  memset(&_stats, 0, sizeof(_stats));
+}
+#endif
+
 // ========================================
 // Internal Helper Functions
 // ========================================
-void MAX7219::sendCommand(uint8_t address, uint8_t data) {
-  digitalWrite(_csPin, LOW);
-  delayMicroseconds(1);
-  sendByte(address);
-  sendByte(data);
-  delayMicroseconds(1);
-  digitalWrite(_csPin, HIGH);
-  delayMicroseconds(1);
+void MAX7219Display::sendCommand(uint8_t address, uint8_t data) {
+  if (address >= MAX7219_REG_DIGIT0 && address <= MAX7219_REG_DIGIT7) {
+    // A digit left in no-decode by displayHex()/displayBinary() gets the
+    // mode's decoding back when it is overwritten
+    uint8_t bit = 1 << (address - MAX7219_REG_DIGIT0);
+    if ((_decodeReg ^ _mode) & bit) {
+      _decodeReg ^= bit;
+      writeRegister(MAX7219_REG_DECODE, _decodeReg);
+    }
+  }
+  writeRegister(address, data);
+}
+
+void MAX7219Display::writeRegister(uint8_t address, uint8_t data) {
+#ifdef MAX7219_ENABLE_STATS
+  unsigned long startUs = micros();
+#endif
+  
+  if (address >= MAX7219_REG_DIGIT0 && address <= MAX7219_REG_DIGIT7) {
+    _digitCache[address - MAX7219_REG_DIGIT0] = data;
+  }
+  
+  _transport->select();
+  _transport->transfer(address, data);
+  _transport->latch();
+  
+  MAX7219_STAT_ADD(registerWrites, 1);
+  MAX7219_STAT_ADD(bitsClocked, _transport->windowBits());
+  MAX7219_STAT_ADD(busMicros, micros() - startUs);
 }
 
-void MAX7219::sendByte(uint8_t data) {
-  for (int i = 7; i >= 0; i--) {
-    sendBit((data >> i) & 0x01);
+#ifndef MAX7219_NO_SCRUB
+void MAX7219Display::scrubNext() {
+  // Round-robin over control registers, then the active digit registers
+  uint8_t slot = _scrubIndex;
+  _scrubIndex = (slot + 1 < 5 + _numDigits) ? slot + 1 : 0;
+  MAX7219_STAT_ADD(scrubWrites, 1);
+  
+  switch (slot) {
+    case 0: sendCommand(MAX7219_REG_DECODE, _decodeReg); break;
+    case 1: sendCommand(MAX7219_REG_SCANLIMIT, _scanLimit); break;
+    case 2: sendCommand(MAX7219_REG_INTENSITY, scaledIntensity()); break;
+    case 3: sendCommand(MAX7219_REG_SHUTDOWN, shutdownValue()); break;
+    case 4: sendCommand(MAX7219_REG_DISPLAYTEST, 0x00); break;
+    default:
+      // Replay the digit as cached; sendCommand() would reset its decode bit
+      writeRegister(MAX7219_REG_DIGIT0 + (slot - 5), _digitCache[slot - 5]);
+      break;
   }
 }
+#endif
 
-void MAX7219::sendBit(uint8_t bit) {
-  digitalWrite(_dinPin, bit ? HIGH : LOW);
-  delayMicroseconds(1);
-  digitalWrite(_clkPin, HIGH);
-  delayMicroseconds(1);
-  digitalWrite(_clkPin, LOW);
+#ifndef MAX7219_NO_POWER
+bool MAX7219Display::applyScanLimit() {
+  // Scan up to the highest digit register that has something lit
+  uint8_t limit = _numDigits - 1;
+  if (_lowPower) {
+    while (limit > 0 && digitGlyph(limit) == SEGMENT_BLANK) limit--;
+    
+    // Below (2I+1)(k+1) = n even intensity 0 drives each digit for longer
+    // than the full scan did: scan wider instead of getting brighter
+    while (limit < _numDigits - 1 && (2 * _brightness + 1) * (limit + 1) < _numDigits) limit++;
+  }
+  if (limit == _scanLimit) return false;
+  
+  // Dim before scanning fewer digits, brighten after scanning more, so the
+  // display never flashes brighter in between
+  bool shrinking = limit < _scanLimit;
+  if (!shrinking) sendCommand(MAX7219_REG_SCANLIMIT, limit);
+  _scanLimit = limit;
+  sendCommand(MAX7219_REG_INTENSITY, scaledIntensity());
+  if (shrinking) sendCommand(MAX7219_REG_SCANLIMIT, limit);
+  return true;
 }
+#endif
 
-uint8_t MAX7219::getPhysicalPosition(uint8_t logicalPosition) {
-  if (_alignment == MAX7219_ALIGN_LEFT) {
-    return _numDigits - 1 - logicalPosition;  // Left-to-right
-  } else if (_alignment == MAX7219_ALIGN_RIGHT) {
-    return logicalPosition;  // Right-to-left
-  } else {  // CENTER
-    // For center alignment, treat logical positions same as left alignment
-    return _numDigits - 1 - logicalPosition;
+uint8_t MAX7219Display::scaledIntensity() {
+#ifdef MAX7219_NO_POWER
+  return _brightness;  // Always the full scan
+#else
+  // Scanning k+1 of n digits gives each digit n/(k+1) times more on-time, so
+  // scale the PWM duty (2I+1)/32 by (k+1)/n, rounding down so no digit gets
+  // brighter: the largest I' with 2I'+1 <= (2I+1)(k+1)/n. applyScanLimit()
+  // keeps (2I+1)(k+1) >= n
+  return ((2 * _brightness + 1) * (_scanLimit + 1) - _numDigits) / (2 * _numDigits);
+#endif
+}
+
+uint8_t MAX7219Display::shutdownValue() {
+  // Shutdown register for the current power state; sleep keeps the chip off
+#ifndef MAX7219_NO_POWER
+  if (_asleep) return 0x00;
+#endif
+  return _power ? 0x01 : 0x00;
+}
+
+uint8_t MAX7219Display::digitGlyph(uint8_t digit) {
+  // Segments lit by a digit register, whether it holds a BCD code or a pattern
+  uint8_t data = _digitCache[digit];
+  if (!(_decodeReg & (1 << digit))) return data;
+  
+  uint8_t code = data & 0x0F;
+  uint8_t segments;
+  if (code <= 9) {
+    segments = SEGMENT_DIGITS[code];
+  } else {
+    segments = SEGMENT_CODE_B[code - 10];
   }
+  return segments | (data & SEGMENT_DOT);
 }
 
-uint8_t MAX7219::charToSegments(char c) {
+bool MAX7219Display::writeDigit(uint8_t digit, uint8_t data) {
+  // Skip the bus write when the chip already shows this value
+  if (_digitCache[digit] == data && !((_decodeReg ^ _mode) & (1 << digit))) {
+    MAX7219_STAT_ADD(writesSuppressed, 1);
+    return false;
+  }
+  sendCommand(MAX7219_REG_DIGIT0 + digit, data);
+  return true;
+}
+
+void MAX7219Display::standardWiring() {
+  // Standard modules: leftmost digit on the highest digit register. Kept
+  // apart from setDigitOrder() so sketches that never rewire do not link
+  // the permutation check
+  for (uint8_t col = 0; col < _numDigits; col++) {
+    _colMap[col] = _numDigits - 1 - col;
+  }
+  buildPositionMap();
+}
+
+void MAX7219Display::buildPositionMap() {
+  // Resolve alignment once so rendering is a table lookup per digit
+  for (uint8_t pos = 0; pos < _numDigits; pos++) {
+    if (_alignment == MAX7219_ALIGN_RIGHT) {
+      _posMap[pos] = _colMap[_numDigits - 1 - pos];  // Right-to-left
+    } else {
+      _posMap[pos] = _colMap[pos];  // Left-to-right (LEFT and CENTER)
+    }
+  }
+}
+
+uint8_t MAX7219Display::charToSegments(char c) {
   if (c >= '0' && c <= '9') {
     return SEGMENT_DIGITS[c - '0'];
+#ifndef MAX7219_NO_TEXT
   } else if (c >= 'A' && c <= 'Z') {
     return SEGMENT_LETTERS[c - 'A'];
   } else if (c >= 'a' && c <= 'z') {
     return SEGMENT_LETTERS[c - 'a'];
+#elif !defined(MAX7219_NO_HEXBIN)
+  } else if (c >= 'A' && c <= 'F') {
+    return SEGMENT_HEX[c - 'A'];  // Hex digits still print without the letter table
+  } else if (c >= 'a' && c <= 'f') {
+    return SEGMENT_HEX[c - 'a'];
+#endif
   } else if (c == '-') {
     return SEGMENT_MINUS;
   } else if (c == ' ') {
@@ -474,14 +776,33 @@ uint8_t MAX7219::charToSegments(char c) {
   return SEGMENT_BLANK;
 }
 
-uint8_t MAX7219::digitToSegments(uint8_t digit) {
+uint8_t MAX7219Display::encodeChar(char c, bool dp) {
+  if (_mode == MAX7219_MODE_DECODE) {
+    // BCD mode: only supports digits
+    if (c >= '0' && c <= '9') {
+      uint8_t data = c - '0';
+      if (dp) data |= 0x80;
+      return data;
+    } else if (c == '-') {
+      return 0x0A;
+    }
+    return 0x0F;  // Blank
+  }
+  
+  // No-decode mode: supports all characters
+  uint8_t segments = charToSegments(c);
+  if (dp) segments |= SEGMENT_DOT;
+  return segments;
+}
+
+uint8_t MAX7219Display::digitToSegments(uint8_t digit) {
   if (digit <= 9) {
     return SEGMENT_DIGITS[digit];
   }
   return SEGMENT_BLANK;
 }
 
-void MAX7219::displayNumberInternal(long number, bool leadingZeros) {
+void MAX7219Display::displayNumberInternal(long number, bool leadingZeros) {
   bool negative = number < 0;
   if (negative) number = -number;
   
@@ -502,47 +823,28 @@ void MAX7219::displayNumberInternal(long number, bool leadingZeros) {
     }
   }
   
-  // Display digits in correct order
+  renderDigits(digits, numDigits, 0xFF, negative, leadingZeros);
+  MAX7219_STAT_ADD(framesFlushed, 1);
+}
+
+void MAX7219Display::renderDigits(const uint8_t* digits, uint8_t count, uint8_t dpDigit, bool negative, bool leadingZeros) {
+  // Logical position of the most significant digit and direction per digit
+  uint8_t startPos = (_alignment == MAX7219_ALIGN_CENTER) ? (_numDigits - count) / 2 : 0;
+  uint8_t pos = (_alignment == MAX7219_ALIGN_RIGHT) ? count - 1 : startPos;
+  int8_t step = (_alignment == MAX7219_ALIGN_RIGHT) ? -1 : 1;
+  
   uint8_t lastPos = 0;
   bool hasShownDigit = false;
   
-  // Calculate starting position based on alignment
-  uint8_t startPos;
-  if (_alignment == MAX7219_ALIGN_RIGHT) {
-    // Right align: fill from rightmost positions
-    startPos = 0;
-  } else if (_alignment == MAX7219_ALIGN_CENTER) {
-    // Center align: calculate center position
-    startPos = (_numDigits - numDigits) / 2;
-  } else {  // LEFT
-    // Left align: fill from leftmost positions
-    startPos = 0;
-  }
-  
-  // Display digits in correct order
-  for (int i = numDigits - 1; i >= 0; i--) {
-    uint8_t pos;
-    if (_alignment == MAX7219_ALIGN_RIGHT) {
-      // Right align: most significant (i=4, digit 1) goes to logical position 4, least (i=0, digit 5) to logical 0
-      pos = i;  // i=4→pos=4, i=3→pos=3, ..., i=0→pos=0
-    } else if (_alignment == MAX7219_ALIGN_CENTER) {
-      // Center align: most significant digit at startPos, then increment
-      pos = startPos + (numDigits - 1 - i);
-    } else {  // LEFT
-      // Left align: most significant (i=4, digit 1) goes to logical position 0, least (i=0, digit 5) to logical 4
-      pos = numDigits - 1 - i;  // i=4→pos=0, i=3→pos=1, ..., i=0→pos=4
-    }
-    
+  // Digits are stored least significant first
+  for (int i = count - 1; i >= 0; i--, pos += step) {
     if (!leadingZeros && !hasShownDigit && digits[i] == 0 && i > 0) {
       // Skip leading zeros
-        uint8_t physPos = getPhysicalPosition(pos);
-        if (_mode == MAX7219_MODE_DECODE) {
-          sendCommand(MAX7219_REG_DIGIT0 + physPos, 0x0F);
-        } else {
-          sendCommand(MAX7219_REG_DIGIT0 + physPos, SEGMENT_BLANK);
+      if (pos < _numDigits) {
+        sendCommand(MAX7219_REG_DIGIT0 + _posMap[pos], encodeChar(' ', false));
       }
     } else {
-      displayAt(pos, digits[i]);
+      displayAt(pos, digits[i], i == dpDigit);
       hasShownDigit = true;
       lastPos = pos;
     }
@@ -565,16 +867,23 @@ void MAX7219::displayNumberInternal(long number, bool leadingZeros) {
   }
 }
 
-void MAX7219::displayFloatInternal(double number, uint8_t decimals) {
+#ifndef MAX7219_NO_FLOAT
+void MAX7219Display::displayFloatInternal(double number, uint8_t decimals) {
   if (decimals >= _numDigits) decimals = _numDigits - 1;
   
-  // Clear display first
-  clear();
-  
   long multiplier = 1;
   for (uint8_t i = 0; i < decimals; i++) multiplier *= 10;
   
-  long intValue = (long)(number * multiplier);
+  displayFixedInternal((long)(number * multiplier), decimals);
+}
+#endif
+
+void MAX7219Display::displayFixedInternal(long intValue, uint8_t decimals) {
+  if (decimals >= _numDigits) decimals = _numDigits - 1;
+  
+  // Clear display first
+  clear();
+  
   bool negative = intValue < 0;
   if (negative) intValue = -intValue;
   
@@ -592,103 +901,128 @@ void MAX7219::displayFloatInternal(double number, uint8_t decimals) {
     }
   }
   
-  // Display digits in correct order
-  uint8_t lastPos = 0;
-  bool hasShownDigit = false;
+  // At least one digit before the point: 5 with 2 decimals shows 0.05
+  while (numDigits <= decimals) digits[numDigits++] = 0;
   
-  // Calculate starting position based on alignment
-  uint8_t startPos;
+  // Decimal point goes on the last integer digit, 'decimals' places from the right
+  uint8_t dpDigit = (decimals > 0) ? decimals : 0xFF;
+  renderDigits(digits, numDigits, dpDigit, negative, true);
+  MAX7219_STAT_ADD(framesFlushed, 1);
+}
+
+#ifndef MAX7219_NO_TEXT
+void MAX7219Display::displayTextInternal(const char* text) {
+  int len = strlen(text);
+  uint8_t count = (len < _numDigits) ? len : _numDigits;
+  
+  // Text longer than the display shows its last characters, except when left-aligned
+  int textStartIdx = (len > _numDigits && _alignment != MAX7219_ALIGN_LEFT) ? len - _numDigits : 0;
+  
+  // Logical position of the first character and direction per character
+  uint8_t pos;
+  int8_t step;
   if (_alignment == MAX7219_ALIGN_RIGHT) {
-    startPos = 0;
+    pos = count - 1;
+    step = -1;
   } else if (_alignment == MAX7219_ALIGN_CENTER) {
-    startPos = (_numDigits - numDigits) / 2;
+    pos = (_numDigits - count) / 2;
+    step = 1;
   } else {  // LEFT
-    startPos = 0;
+    pos = 0;
+    step = 1;
   }
   
-  for (int i = numDigits - 1; i >= 0; i--) {
-    uint8_t pos;
-    if (_alignment == MAX7219_ALIGN_RIGHT) {
-      pos = i;
-    } else if (_alignment == MAX7219_ALIGN_CENTER) {
-      pos = startPos + (numDigits - 1 - i);
-    } else {  // LEFT
-      pos = numDigits - 1 - i;
-    }
-    bool showDP = (numDigits - 1 - i == decimals);
-    displayAt(pos, digits[i], showDP);
-    hasShownDigit = true;
-    lastPos = pos;
+  clear();
+  
+  for (uint8_t i = 0; i < count; i++, pos += step) {
+    sendCommand(MAX7219_REG_DIGIT0 + _posMap[pos], encodeChar(text[textStartIdx + i], false));
   }
+  MAX7219_STAT_ADD(framesFlushed, 1);
+}
+#endif
+
+#ifndef MAX7219_NO_TEXT
+void MAX7219Display::scrollFrame(const char* text, int len, int offset) {
+  // One frame of a scroll: the text with its first character at 'offset'
+  clear();
   
-  // Display negative sign at the leftmost position if needed
-  if (negative && hasShownDigit) {
-    uint8_t leftmostPos;
-    if (_alignment == MAX7219_ALIGN_LEFT) {
-      leftmostPos = 0;
-    } else if (_alignment == MAX7219_ALIGN_CENTER) {
-      // For center, place negative sign one position before the number
-      leftmostPos = (startPos > 0) ? startPos - 1 : 0;
-    } else {  // RIGHT
-      leftmostPos = _numDigits - 1;
-    }
-    if (leftmostPos != lastPos && leftmostPos < _numDigits) {
-      displayAt(leftmostPos, '-');
+  for (int i = 0; i < len; i++) {
+    int pos = offset + i;
+    if (pos >= 0 && pos < _numDigits) {
+      displayAt(pos, text[i]);
     }
   }
 }
+#endif
 
-void MAX7219::displayTextInternal(const char* text) {
-  int len = strlen(text);
-  int textStartIdx = 0;
-  int logicalStartPos = 0;
+void MAX7219Display::displayRowInternal(const char* chars, uint8_t count) {
+  if (count > _numDigits) count = _numDigits;
   
-  clear();
+  // Column of the first character (0 = leftmost)
+  uint8_t startCol;
+  if (_alignment == MAX7219_ALIGN_LEFT) {
+    startCol = 0;
+  } else if (_alignment == MAX7219_ALIGN_CENTER) {
+    startCol = (_numDigits - count) / 2;
+  } else {  // RIGHT
+    startCol = _numDigits - count;
+  }
   
-  if (_alignment == MAX7219_ALIGN_RIGHT) {
-    // For right alignment: text starts at logical position 0 (rightmost)
-    if (len <= _numDigits) {
-      // Text fits: display from rightmost positions
-      logicalStartPos = 0;
-      textStartIdx = 0;
-      // Display text in reverse order so first char appears on left, last char on right
-      for (int i = 0; i < len && i < _numDigits; i++) {
-        displayAt(len - 1 - i, text[i]);
-      }
-    } else {
-      // Text is longer: show last _numDigits characters
-      textStartIdx = len - _numDigits;
-      for (int i = 0; i < _numDigits; i++) {
-        displayAt(_numDigits - 1 - i, text[textStartIdx + i]);
-      }
+  // Code B has no letters: a row that needs them (print(value, HEX)) is
+  // drawn as segment patterns, like displayHex()
+  bool raw = false;
+  if (_mode == MAX7219_MODE_DECODE) {
+    for (uint8_t i = 0; i < count; i++) {
+      char c = chars[i] & 0x7F;
+      if ((c < '0' || c > '9') && c != '-' && c != ' ') raw = true;
     }
-  } else if (_alignment == MAX7219_ALIGN_CENTER) {
-    // For center alignment: calculate center position
-    if (len <= _numDigits) {
-      logicalStartPos = (_numDigits - len) / 2;
-      textStartIdx = 0;
-      for (int i = 0; i < len && i < _numDigits; i++) {
-        displayAt(logicalStartPos + i, text[textStartIdx + i]);
-      }
-    } else {
-      // Text is longer: show last _numDigits characters centered
-      logicalStartPos = 0;
-      textStartIdx = len - _numDigits;
-      for (int i = 0; i < _numDigits; i++) {
-        displayAt(logicalStartPos + i, text[textStartIdx + i]);
+  }
+  
+  if (raw) {
+    useRawGlyphs();
+    for (uint8_t col = 0; col < _numDigits; col++) {
+      uint8_t segments = SEGMENT_BLANK;
+      if (col >= startCol && col < startCol + count) {
+        char c = chars[col - startCol];
+        segments = charToSegments((char)(c & 0x7F));
+        if (c & 0x80) segments |= SEGMENT_DOT;
       }
+      writeGlyph(_colMap[col], segments);
     }
-  } else {  // LEFT
-    // For left alignment: text starts at logical position 0 (leftmost)
-    logicalStartPos = 0;
-    textStartIdx = 0;
-    for (int i = 0; i < _numDigits && (textStartIdx + i) < len; i++) {
-      displayAt(logicalStartPos + i, text[textStartIdx + i]);
+  } else {
+    clear();
+    for (uint8_t i = 0; i < count; i++) {
+      sendCommand(MAX7219_REG_DIGIT0 + _colMap[startCol + i],
+                  encodeChar((char)(chars[i] & 0x7F), (chars[i] & 0x80) != 0));
     }
   }
-  
-  // For left alignment with short text, remaining positions are already blank (from clear())
-  // For right alignment with short text, clear() already blanked everything, then we display
-  // starting from logicalStartPos which handles the padding
+  MAX7219_STAT_ADD(framesFlushed, 1);
 }
 
+void MAX7219Display::useRawGlyphs() {
+  // Switch every digit to no-decode in one write; the mode itself is kept
+  // and digits regain its decoding when other functions overwrite them
+  if (_decodeReg != MAX7219_MODE_NO_DECODE) {
+    _decodeReg = MAX7219_MODE_NO_DECODE;
+    writeRegister(MAX7219_REG_DECODE, _decodeReg);
+  }
+}
+
+void MAX7219Display::writeRawSegments(uint8_t digit, uint8_t segments) {
+  // Only this digit leaves decoding; the others keep what they show
+  uint8_t bit = 1 << digit;
+  if (_decodeReg & bit) {
+    _decodeReg &= ~bit;
+    writeRegister(MAX7219_REG_DECODE, _decodeReg);
+  }
+  writeGlyph(digit, segments);
+}
+
+void MAX7219Display::writeGlyph(uint8_t digit, uint8_t segments) {
+  // Diff against the cache so an unchanged digit costs no bus write
+  if (_digitCache[digit] == segments) {
+    MAX7219_STAT_ADD(writesSuppressed, 1);
+    return;
+  }
+  writeRegister(MAX7219_REG_DIGIT0 + digit, segments);
+}
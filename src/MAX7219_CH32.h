@@ -21,6 +21,39 @@
 #define MAX7219_CH32_H
 
 #include <Arduino.h>
+#include "MAX7219_Transport.h"
+
+// ========================================
+// Feature Selection
+// ========================================
+// Define any of these as build flags to strip a whole feature group from
+// the library. MAX7219_MINIMAL strips all of them (numeric-only build).
+//   MAX7219_NO_ANIMATIONS - blink, fadeIn, fadeOut, scroll, chase, countUp/countDown
+//   MAX7219_NO_FLOAT      - display(double) and its floating point math
+//   MAX7219_NO_TEXT       - display(const char*), scroll, letter glyphs
+//   MAX7219_NO_HEXBIN     - displayHex, displayBinary, hex glyphs
+//   MAX7219_NO_SCRUB      - setScrubRate and register scrubbing in update()
+//   MAX7219_NO_POWER      - low-power scanning, sleep/wake, estimateCurrent
+#ifdef MAX7219_MINIMAL
+#ifndef MAX7219_NO_ANIMATIONS
+#define MAX7219_NO_ANIMATIONS
+#endif
+#ifndef MAX7219_NO_FLOAT
+#define MAX7219_NO_FLOAT
+#endif
+#ifndef MAX7219_NO_TEXT
+#define MAX7219_NO_TEXT
+#endif
+#ifndef MAX7219_NO_HEXBIN
+#define MAX7219_NO_HEXBIN
+#endif
+#ifndef MAX7219_NO_SCRUB
+#define MAX7219_NO_SCRUB
+#endif
+#ifndef MAX7219_NO_POWER
+#define MAX7219_NO_POWER
+#endif
+#endif
 
 // ========================================
 // Display Modes
@@ -54,22 +87,54 @@
 #define MAX7219_REG_DISPLAYTEST 0x0F
 
 // ========================================
-// MAX7219 Class
+// Power Model
+// ========================================
+// Chip supply current used by estimateCurrent(), in microamps (datasheet
+// maxima: operating with all segments off, and shutdown).
+#ifndef MAX7219_OPERATING_CURRENT_UA
+#define MAX7219_OPERATING_CURRENT_UA 8000UL
+#endif
+#ifndef MAX7219_SHUTDOWN_CURRENT_UA
+#define MAX7219_SHUTDOWN_CURRENT_UA  150UL
+#endif
+
 // ========================================
+// Instrumentation
+// ========================================
+// Define MAX7219_ENABLE_STATS (as a build flag, so the library sees it too)
+// to count bus usage. When it is not defined the counters compile away.
+#ifdef MAX7219_ENABLE_STATS
 /**
- * @class MAX7219
- * @brief Main class for controlling MAX7219 7-segment displays
+ * @struct MAX7219Stats
+ * @brief Snapshot of display bus usage counters
  */
-class MAX7219 {
+struct MAX7219Stats {
+  uint32_t registerWrites;    // Register writes sent to the chip
+  uint32_t bitsClocked;       // Bits shifted out on DIN (chain: NOOP padding in, buffered writes out)
+  uint32_t writesSuppressed;  // Writes skipped because the cached value matched
+  uint32_t framesFlushed;     // Complete renders (numbers, text, time, hex, ...)
+  uint32_t scrubWrites;       // Registers rewritten by background scrubbing
+  uint32_t busMicros;         // Cumulative time spent in sendCommand
+};
+#endif
+
+// ========================================
+// MAX7219Display Class
+// ========================================
+/**
+ * @class MAX7219Display
+ * @brief Display driver on any bus transport (hardware SPI, chain, mock, ...)
+ * 
+ * MAX7219 below is the same driver with its own bit-bang bus on three pins.
+ */
+class MAX7219Display {
 public:
   /**
-   * @brief Constructor for MAX7219 display
-   * @param dinPin Data input pin (MOSI)
-   * @param clkPin Clock pin (SCK)
-   * @param csPin Chip select pin (CS/SS)
+   * @brief Constructor for MAX7219 display on a custom transport
+   * @param transport Bus transport (hardware SPI, mock, ...)
    * @param numDigits Number of digits (1-8, default: 8)
    */
-  MAX7219(uint8_t dinPin, uint8_t clkPin, uint8_t csPin, uint8_t numDigits = 8);
+  MAX7219Display(MAX7219Transport& transport, uint8_t numDigits = 8);
   
   // ========================================
   // Initialization
@@ -112,6 +177,13 @@ public:
    */
   uint8_t getAlignment();
   
+  /**
+   * @brief Set digit wiring for modules with a non-standard digit order
+   * @param order order[c] = digit register (0 = DIGIT0) driving column c (0 = leftmost),
+   *              one entry per digit, each register once; NULL restores the standard wiring
+   */
+  void setDigitOrder(const uint8_t* order);
+  
   /**
    * @brief Set display brightness
    * @param level Brightness level (0-15, where 0 is dimmest and 15 is brightest)
@@ -124,6 +196,61 @@ public:
    */
   void setPower(bool on);
   
+#ifndef MAX7219_NO_SCRUB
+  /**
+   * @brief Set background register scrubbing rate
+   * @param registersPerUpdate Registers rewritten from cached state per update() call (0 = off)
+   */
+  void setScrubRate(uint8_t registersPerUpdate);
+#endif
+  
+#ifndef MAX7219_NO_POWER
+  /**
+   * @brief Enable or disable low-power scanning
+   * @param on true to scan only up to the highest lit digit register, with the
+   *           intensity lowered to keep the same brightness (applied by update())
+   */
+  void setLowPower(bool on);
+  
+  /**
+   * @brief Check if low-power scanning is enabled
+   */
+  bool isLowPower();
+  
+  /**
+   * @brief Shut the chip down after a period without display changes
+   * @param ms Time without changes before sleeping (0 = never, default)
+   */
+  void setSleepTimeout(unsigned long ms);
+  
+  /**
+   * @brief Shut the chip down and park the bus pins; display content is kept
+   */
+  void sleep();
+  
+  /**
+   * @brief Leave sleep and restore all registers from the cached state
+   */
+  void wake();
+  
+  /**
+   * @brief Check if the display is asleep
+   */
+  bool isAsleep();
+  
+  /**
+   * @brief Estimate the chip supply current for the current state
+   * @param segmentCurrentMa Peak segment current set by RSET (default: 40 mA)
+   * @return Estimated average current in microamps
+   */
+  uint32_t estimateCurrent(uint8_t segmentCurrentMa = 40);
+#endif
+  
+  /**
+   * @brief Run background tasks (scrubbing, low-power scanning, sleep timeout); call regularly from loop()
+   */
+  void update();
+  
   /**
    * @brief Clear all digits
    */
@@ -132,11 +259,13 @@ public:
   // ========================================
   // Display Functions (Mode-Aware)
   // ========================================
+#ifndef MAX7219_NO_TEXT
   /**
    * @brief Display text string
    * @param text Text to display (null-terminated string)
    */
   void display(const char* text);
+#endif
   
   /**
    * @brief Display integer
@@ -150,12 +279,21 @@ public:
    */
   void display(long number);
   
+#ifndef MAX7219_NO_FLOAT
   /**
    * @brief Display floating point number
    * @param number Floating point value to display
    * @param decimals Number of decimal places (default: 2)
    */
   void display(double number, uint8_t decimals = 2);
+#endif
+  
+  /**
+   * @brief Display fixed-point number without floating point math
+   * @param value Scaled integer value (e.g. 1234 with 2 decimals shows 12.34)
+   * @param decimals Number of decimal places
+   */
+  void displayFixed(long value, uint8_t decimals);
   
   /**
    * @brief Display value at specific position
@@ -191,6 +329,7 @@ public:
    */
   void displayTime(uint8_t hours, uint8_t minutes, uint8_t seconds);
   
+#ifndef MAX7219_NO_HEXBIN
   /**
    * @brief Display value in hexadecimal format
    * @param value Value to display in hex
@@ -202,7 +341,9 @@ public:
    * @param value Value to display in binary (requires 8 digits)
    */
   void displayBinary(uint8_t value);
+#endif
   
+#ifndef MAX7219_NO_ANIMATIONS
   // ========================================
   // Animations
   // ========================================
@@ -225,6 +366,7 @@ public:
    */
   void fadeOut(uint16_t delayMs = 50);
   
+#ifndef MAX7219_NO_TEXT
   /**
    * @brief Scroll text across display
    * @param text Text to scroll
@@ -238,6 +380,7 @@ public:
    * @param delayMs Delay between scroll steps in milliseconds (default: 200)
    */
   void scroll(long number, uint16_t delayMs = 200);
+#endif
   
   /**
    * @brief Chase animation (digit-by-digit)
@@ -260,6 +403,7 @@ public:
    * @param delayMs Delay between counts in milliseconds (default: 100)
    */
   void countDown(long from, long to, uint16_t delayMs = 100);
+#endif
   
   // ========================================
   // Low-Level Control
@@ -279,28 +423,129 @@ public:
    */
   void setRawDigit(uint8_t position, uint8_t value, bool dp = false);
   
+#ifdef MAX7219_ENABLE_STATS
+  // ========================================
+  // Instrumentation
+  // ========================================
+  /**
+   * @brief Get a snapshot of the bus usage counters
+   * @return Copy of the current counters
+   */
+  MAX7219Stats getStats();
+  
+  /**
+   * @brief Reset all bus usage counters to zero
+   */
+  void resetStats();
+#endif
+  
 private:
-  // Pin configuration
-  uint8_t _dinPin;
-  uint8_t _clkPin;
-  uint8_t _csPin;
+  friend class MAX7219Print;
+  friend class MAX7219Protocol;
+  friend class MAX7219LevelMeter;
+  friend class MAX7219Region;
+  friend class MAX7219Timeline;
+  
+  // Bus configuration
+  MAX7219Transport* _transport;
   
   // Display configuration
   uint8_t _numDigits;
   uint8_t _mode;
+  uint8_t _decodeReg;   // Decode register as written (differs from _mode after displayHex())
   uint8_t _alignment;
   uint8_t _brightness;
+  bool _power;
+  
+  // Digit maps (digit register index, 0 = DIGIT0), rebuilt when wiring or alignment changes
+  uint8_t _colMap[8];  // Column (0 = leftmost) to digit register
+  uint8_t _posMap[8];  // Logical position for the current alignment to digit register
+  
+  // Cached digit registers (index 0 = DIGIT0), used to restore state
+  uint8_t _digitCache[8];
+  
+  uint8_t _scanLimit;             // Value of the scan-limit register
+  
+#ifndef MAX7219_NO_SCRUB
+  // Background scrubbing
+  uint8_t _scrubRate;
+  uint8_t _scrubIndex;
+#endif
+  
+#ifndef MAX7219_NO_POWER
+  // Power management
+  bool _lowPower;
+  bool _asleep;
+  unsigned long _sleepTimeout;
+  unsigned long _lastChange;      // millis() of the last display change seen by update()
+  uint8_t _lastFrame[8];          // Digit registers at the last update()
+#endif
+  
+#ifdef MAX7219_ENABLE_STATS
+  MAX7219Stats _stats;
+#endif
   
   // Internal functions
   void sendCommand(uint8_t address, uint8_t data);
-  void sendByte(uint8_t data);
-  void sendBit(uint8_t bit);
-  uint8_t getPhysicalPosition(uint8_t logicalPosition);
+  void writeRegister(uint8_t address, uint8_t data);
+  void init(uint8_t numDigits);
+#ifndef MAX7219_NO_SCRUB
+  void scrubNext();
+#endif
+#ifndef MAX7219_NO_POWER
+  bool applyScanLimit();
+#endif
+  uint8_t scaledIntensity();
+  uint8_t shutdownValue();
+  uint8_t digitGlyph(uint8_t digit);
+  bool writeDigit(uint8_t digit, uint8_t data);
+  void standardWiring();
+  void buildPositionMap();
   uint8_t charToSegments(char c);
+  uint8_t encodeChar(char c, bool dp);
   uint8_t digitToSegments(uint8_t digit);
   void displayNumberInternal(long number, bool leadingZeros = false);
+  void renderDigits(const uint8_t* digits, uint8_t count, uint8_t dpDigit, bool negative, bool leadingZeros);
+#ifndef MAX7219_NO_FLOAT
   void displayFloatInternal(double number, uint8_t decimals);
+#endif
+  void displayFixedInternal(long intValue, uint8_t decimals);
+#ifndef MAX7219_NO_TEXT
   void displayTextInternal(const char* text);
+  void scrollFrame(const char* text, int len, int offset);
+#endif
+  void displayRowInternal(const char* chars, uint8_t count);
+  void useRawGlyphs();
+  void writeRawSegments(uint8_t digit, uint8_t segments);
+  void writeGlyph(uint8_t digit, uint8_t segments);
+};
+
+// ========================================
+// MAX7219 Class
+// ========================================
+/**
+ * @class MAX7219
+ * @brief Main class for controlling MAX7219 7-segment displays, bit-banged on any three pins
+ */
+class MAX7219 : public MAX7219Display {
+public:
+  /**
+   * @brief Constructor for MAX7219 display
+   * @param dinPin Data input pin (MOSI)
+   * @param clkPin Clock pin (SCK)
+   * @param csPin Chip select pin (CS/SS)
+   * @param numDigits Number of digits (1-8, default: 8)
+   */
+  MAX7219(uint8_t dinPin, uint8_t clkPin, uint8_t csPin, uint8_t numDigits = 8);
+  
+  /**
+   * @brief Set minimum CLK half-period
+   * @param microseconds Delay after each clock edge (0 = no delay, fastest)
+   */
+  void setClockHalfPeriod(uint8_t microseconds);
+  
+private:
+  MAX7219BitBang _bitBang;
 };
 
 #endif // MAX7219_CH32_H
@@ -0,0 +1,196 @@
+/*
+ * MAX7219_Chain.cpp - Daisy-Chained MAX7219 Chips Implementation
+ *
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "MAX7219_Chain.h"
+#include "MAX7219_CH32.h"
+
+// ========================================
+// MAX7219ChainSlot
+// ========================================
+MAX7219ChainSlot::MAX7219ChainSlot() {
+  _chain = 0;
+  _index = 0;
+  _hasPending = false;
+#ifdef MAX7219_ENABLE_STATS
+  _windowBits = 0;
+#endif
+}
+
+void MAX7219ChainSlot::begin() {
+  _chain->beginBus();
+}
+
+void MAX7219ChainSlot::select() {
+  _hasPending = false;
+}
+
+void MAX7219ChainSlot::transfer(uint8_t address, uint8_t data) {
+  // The chain decides how the word reaches the bus once the window closes
+  _address = address;
+  _data = data;
+  _hasPending = true;
+}
+
+void MAX7219ChainSlot::latch() {
+  uint16_t bits = 0;
+  if (_hasPending) {
+    bits = _chain->write(_index, _address, _data);
+    _hasPending = false;
+  }
+#ifdef MAX7219_ENABLE_STATS
+  _windowBits = bits;
+#else
+  (void)bits;
+#endif
+}
+
+void MAX7219ChainSlot::idle() {
+  // The bus is shared; parking it is harmless since the next write drives it again
+  _chain->_bus->idle();
+}
+
+#ifdef MAX7219_ENABLE_STATS
+uint16_t MAX7219ChainSlot::windowBits() {
+  // Buffered digit writes shift nothing until flush()
+  return _windowBits;
+}
+#endif
+
+// ========================================
+// Constructor
+// ========================================
+MAX7219Chain::MAX7219Chain(MAX7219Transport& bus, uint8_t numChips) {
+  _bus = &bus;
+  _numChips = constrain(numChips, 1, MAX7219_CHAIN_MAX_CHIPS);
+  _synchronized = false;
+  _begun = false;
+  _dirtyRows = 0;
+  _dirtyDecode = 0;
+  memset(_frame, 0, sizeof(_frame));
+  memset(_decode, 0, sizeof(_decode));
+#ifdef MAX7219_ENABLE_STATS
+  _bitsClocked = 0;
+#endif
+
+  for (uint8_t i = 0; i < MAX7219_CHAIN_MAX_CHIPS; i++) {
+    _slots[i]._chain = this;
+    _slots[i]._index = i;
+  }
+}
+
+// ========================================
+// Public Functions
+// ========================================
+MAX7219Transport& MAX7219Chain::chip(uint8_t index) {
+  if (index >= _numChips) index = _numChips - 1;
+  return _slots[index];
+}
+
+uint8_t MAX7219Chain::getNumChips() {
+  return _numChips;
+}
+
+void MAX7219Chain::setSynchronized(bool on) {
+  if (!on) flush();
+  _synchronized = on;
+}
+
+bool MAX7219Chain::isSynchronized() {
+  return _synchronized;
+}
+
+void MAX7219Chain::flush() {
+  // Decode modes first, so the digit rows land under the decoding they were
+  // rendered for; chips without a change get a NOOP
+  if (_dirtyDecode) {
+    _bus->select();
+    for (int8_t c = _numChips - 1; c >= 0; c--) {
+      if (_dirtyDecode & (1 << c)) {
+        _bus->transfer(MAX7219_REG_DECODE, _decode[c]);
+      } else {
+        _bus->transfer(MAX7219_REG_NOOP, 0x00);
+      }
+    }
+    _bus->latch();
+#ifdef MAX7219_ENABLE_STATS
+    _bitsClocked += 16 * _numChips;
+#endif
+    _dirtyDecode = 0;
+  }
+  
+  for (uint8_t row = 0; row < 8; row++) {
+    if (!(_dirtyRows & (1 << row))) continue;
+
+    // One window loads this digit register on every chip; the first word
+    // shifted ends up in the last chip
+    _bus->select();
+    for (int8_t c = _numChips - 1; c >= 0; c--) {
+      _bus->transfer(MAX7219_REG_DIGIT0 + row, _frame[c][row]);
+    }
+    _bus->latch();
+#ifdef MAX7219_ENABLE_STATS
+    _bitsClocked += 16 * _numChips;
+#endif
+  }
+  _dirtyRows = 0;
+}
+
+#ifdef MAX7219_ENABLE_STATS
+uint32_t MAX7219Chain::getBitsClocked() {
+  return _bitsClocked;
+}
+
+void MAX7219Chain::resetStats() {
+  _bitsClocked = 0;
+}
+#endif
+
+// ========================================
+// Private Functions
+// ========================================
+void MAX7219Chain::beginBus() {
+  // Every chip's begin() lands here; configure the shared bus once
+  if (_begun) return;
+  _bus->begin();
+  _begun = true;
+}
+
+uint16_t MAX7219Chain::write(uint8_t index, uint8_t address, uint8_t data) {
+  // Returns the bits shifted on the bus now (0 when buffered)
+  if (address >= MAX7219_REG_DIGIT0 && address <= MAX7219_REG_DIGIT7) {
+    uint8_t row = address - MAX7219_REG_DIGIT0;
+    _frame[index][row] = data;
+    if (_synchronized) {
+      _dirtyRows |= (1 << row);
+      return 0;
+    }
+  } else if (address == MAX7219_REG_DECODE && _synchronized) {
+    // Goes out with the frame it belongs to
+    _decode[index] = data;
+    _dirtyDecode |= (1 << index);
+    return 0;
+  }
+
+  // Immediate write: NOOP for every other chip
+  _bus->select();
+  for (int8_t c = _numChips - 1; c >= 0; c--) {
+    if (c == index) {
+      _bus->transfer(address, data);
+    } else {
+      _bus->transfer(MAX7219_REG_NOOP, 0x00);
+    }
+  }
+  _bus->latch();
+  
+  uint16_t bits = 16 * _numChips;
+#ifdef MAX7219_ENABLE_STATS
+  _bitsClocked += bits;
+#endif
+  return bits;
+}
@@ -0,0 +1,150 @@
+/*
+ * MAX7219_Chain.h - Daisy-Chained MAX7219 Chips for MAX7219_CH32
+ *
+ * Several MAX7219 chips can share one DIN/CLK/CS bus, with DOUT of each chip
+ * feeding DIN of the next. MAX7219Chain owns that bus and hands out one
+ * transport per chip, so each chip is driven by an ordinary MAX7219Display.
+ * Writes to one chip are padded with NOOP words for the others.
+ *
+ * In synchronized mode digit writes are buffered and flush() sends them
+ * ordered by digit register: each CS pulse loads the same register on every
+ * chip at once, so a full frame takes at most 8 CS windows regardless of the
+ * chain length and each digit changes on all chips together. Decode-mode
+ * writes are buffered with the frame and latched in their own window before
+ * the digits, so every new digit lands under the decoding it was rendered
+ * for. Until its own window latches, though, each digit still shows its
+ * old value under the new decoding, so a decode-mode change tears for the
+ * rest of the flush (up to 8 windows).
+ *
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef MAX7219_CHAIN_H
+#define MAX7219_CHAIN_H
+
+#include <Arduino.h>
+#include "MAX7219_Transport.h"
+
+// Maximum number of chips in a chain (sets the size of the frame buffer)
+#ifndef MAX7219_CHAIN_MAX_CHIPS
+#define MAX7219_CHAIN_MAX_CHIPS 4
+#endif
+
+class MAX7219Chain;
+
+// ========================================
+// MAX7219ChainSlot Class
+// ========================================
+/**
+ * @class MAX7219ChainSlot
+ * @brief Transport addressing one chip of a MAX7219Chain (see MAX7219Chain::chip())
+ */
+class MAX7219ChainSlot : public MAX7219Transport {
+public:
+  MAX7219ChainSlot();
+
+  virtual void begin();
+  virtual void select();
+  virtual void transfer(uint8_t address, uint8_t data);
+  virtual void latch();
+  virtual void idle();
+#ifdef MAX7219_ENABLE_STATS
+  virtual uint16_t windowBits();
+#endif
+
+private:
+  friend class MAX7219Chain;
+
+  MAX7219Chain* _chain;
+  uint8_t _index;
+  uint8_t _address;  // Word shifted in the current window
+  uint8_t _data;
+  bool _hasPending;
+#ifdef MAX7219_ENABLE_STATS
+  uint16_t _windowBits;  // Bits the chain shifted for the last latch()
+#endif
+};
+
+// ========================================
+// MAX7219Chain Class
+// ========================================
+/**
+ * @class MAX7219Chain
+ * @brief Shares one bus between daisy-chained MAX7219 chips
+ */
+class MAX7219Chain {
+public:
+  /**
+   * @brief Constructor
+   * @param bus Transport driving the first chip of the chain
+   * @param numChips Number of chips (1 to MAX7219_CHAIN_MAX_CHIPS)
+   */
+  MAX7219Chain(MAX7219Transport& bus, uint8_t numChips);
+
+  /**
+   * @brief Transport for one chip, to construct a MAX7219Display with
+   * @param index Chip index (0 = chip connected to the microcontroller)
+   * @return Transport that writes only to that chip
+   */
+  MAX7219Transport& chip(uint8_t index);
+
+  /**
+   * @brief Get number of chips in the chain
+   */
+  uint8_t getNumChips();
+
+  /**
+   * @brief Enable or disable synchronized updates
+   * @param on true to buffer digit and decode-mode writes until flush(), false to send them immediately
+   *           (turning it off flushes pending writes)
+   */
+  void setSynchronized(bool on);
+
+  /**
+   * @brief Check if synchronized updates are enabled
+   */
+  bool isSynchronized();
+
+  /**
+   * @brief Send buffered writes: one CS window for changed decode modes, then one per changed digit register
+   */
+  void flush();
+
+#ifdef MAX7219_ENABLE_STATS
+  /**
+   * @brief Bits shifted on the shared bus, NOOP padding and flush() included
+   */
+  uint32_t getBitsClocked();
+
+  /**
+   * @brief Reset the bit counter to zero
+   */
+  void resetStats();
+#endif
+
+private:
+  friend class MAX7219ChainSlot;
+
+  MAX7219Transport* _bus;
+  uint8_t _numChips;
+  bool _synchronized;
+  bool _begun;
+  uint8_t _dirtyRows;  // Bit n set when digit register n has buffered writes
+  uint8_t _dirtyDecode;  // Bit n set when chip n has a buffered decode mode
+#ifdef MAX7219_ENABLE_STATS
+  uint32_t _bitsClocked;
+#endif
+
+  // Last digit register values per chip (index 0 = DIGIT0)
+  uint8_t _frame[MAX7219_CHAIN_MAX_CHIPS][8];
+  uint8_t _decode[MAX7219_CHAIN_MAX_CHIPS];  // Buffered decode mode per chip
+  MAX7219ChainSlot _slots[MAX7219_CHAIN_MAX_CHIPS];
+
+  void beginBus();
+  uint16_t write(uint8_t index, uint8_t address, uint8_t data);
+};
+
+#endif // MAX7219_CHAIN_H
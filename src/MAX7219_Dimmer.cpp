@@ -0,0 +1,117 @@
+/*
+ * MAX7219_Dimmer.cpp - Non-Blocking Brightness Engine Implementation
+ * 
+ * Implementation file for MAX7219_CH32 library
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include <Arduino.h>
+#include "MAX7219_Dimmer.h"
+
+// ========================================
+// Gamma Table
+// ========================================
+// Perceptual level (every 16th of 0-256) to hardware level in 1/16 steps,
+// using gamma 2.2. Hardware level 0 is "off", level n (1-16) is INTENSITY
+// n-1, whose duty cycle is (2n-1)/32.
+const uint16_t DIMMER_GAMMA[17] = {
+  0, 1, 5, 13, 20, 28, 38, 50, 64, 81, 100, 121, 145, 172, 200, 232, 256
+};
+
+// ========================================
+// Constructor
+// ========================================
+MAX7219Dimmer::MAX7219Dimmer(MAX7219Display& display) : _display(display) {
+  _level = 255;
+  _startLevel = 255;
+  _targetLevel = 255;
+  _fadeMs = 0;
+  _fadeStart = 0;
+  _error = 0;
+  _intensity = 0xFF;  // Unknown: first update() writes it
+  _on = 0xFF;
+}
+
+// ========================================
+// Level Control
+// ========================================
+void MAX7219Dimmer::setLevel(uint8_t level) {
+  _level = level;
+  _targetLevel = level;
+  _fadeMs = 0;
+}
+
+void MAX7219Dimmer::fadeTo(uint8_t level, uint16_t durationMs) {
+  if (durationMs == 0) {
+    setLevel(level);
+    return;
+  }
+  _startLevel = _level;
+  _targetLevel = level;
+  _fadeMs = durationMs;
+  _fadeStart = millis();
+}
+
+uint8_t MAX7219Dimmer::getLevel() {
+  return _level;
+}
+
+bool MAX7219Dimmer::isFading() {
+  return _fadeMs != 0;
+}
+
+// ========================================
+// Background Update
+// ========================================
+void MAX7219Dimmer::update() {
+  // Advance the fade (linear in perceptual space)
+  if (_fadeMs != 0) {
+    unsigned long elapsed = millis() - _fadeStart;
+    if (elapsed >= _fadeMs) {
+      _level = _targetLevel;
+      _fadeMs = 0;
+    } else {
+      int16_t delta = (int16_t)_targetLevel - _startLevel;
+      _level = _startLevel + (int16_t)((int32_t)delta * (int32_t)elapsed / _fadeMs);
+    }
+  }
+  
+  // Dither between the two hardware levels around the target
+  uint16_t target = gammaLevel(_level);
+  uint8_t hw = target >> 4;
+  _error += target & 0x0F;
+  if (_error >= 16) {
+    _error -= 16;
+    hw++;
+  }
+  
+  // At most one register write per call
+  if (hw == 0) {
+    if (_on != 0) {
+      _display.setPower(false);
+      _on = 0;
+    }
+  } else if (_intensity != hw - 1) {
+    _display.setBrightness(hw - 1);
+    _intensity = hw - 1;
+  } else if (_on != 1) {
+    _display.setPower(true);
+    _on = 1;
+  }
+}
+
+uint16_t MAX7219Dimmer::gammaLevel(uint8_t level) {
+  // Interpolation tops out at 15/16 of the last interval, so 255 would land
+  // just below full scale and dither INTENSITY 14/15 forever
+  if (level == 255) return DIMMER_GAMMA[16];
+  
+  uint8_t index = level >> 4;
+  uint8_t fraction = level & 0x0F;
+  uint16_t low = DIMMER_GAMMA[index];
+  uint16_t high = DIMMER_GAMMA[index + 1];
+  return low + (((high - low) * fraction) >> 4);
+}
@@ -0,0 +1,85 @@
+/*
+ * MAX7219_Dimmer.h - Non-Blocking Brightness Engine for MAX7219_CH32
+ * 
+ * Maps a 0-255 perceptual brightness level through a gamma curve onto the
+ * 16 hardware INTENSITY steps, plus "off" below the lowest step. Levels that
+ * fall between two hardware steps are produced by temporal dithering: each
+ * update() picks the lower or upper step so that the average matches the
+ * requested level. Fades run in the background from update().
+ * 
+ * Every update() sends at most one register write (INTENSITY or SHUTDOWN).
+ * Call it at a steady, fast rate (every 1-2 ms) for flicker-free dithering.
+ * While active, the dimmer owns the brightness and power state.
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef MAX7219_DIMMER_H
+#define MAX7219_DIMMER_H
+
+#include <Arduino.h>
+#include "MAX7219_CH32.h"
+
+// ========================================
+// MAX7219Dimmer Class
+// ========================================
+/**
+ * @class MAX7219Dimmer
+ * @brief Gamma-corrected, dithered brightness control with background fades
+ */
+class MAX7219Dimmer {
+public:
+  /**
+   * @brief Constructor
+   * @param display Display to control
+   */
+  MAX7219Dimmer(MAX7219Display& display);
+  
+  /**
+   * @brief Set perceptual brightness immediately
+   * @param level Brightness (0 = off, 255 = maximum)
+   */
+  void setLevel(uint8_t level);
+  
+  /**
+   * @brief Fade to a perceptual brightness in the background
+   * @param level Target brightness (0 = off, 255 = maximum)
+   * @param durationMs Fade duration in milliseconds
+   */
+  void fadeTo(uint8_t level, uint16_t durationMs);
+  
+  /**
+   * @brief Get current perceptual brightness
+   * @return Brightness (0-255)
+   */
+  uint8_t getLevel();
+  
+  /**
+   * @brief Check whether a fade is in progress
+   * @return true while fading
+   */
+  bool isFading();
+  
+  /**
+   * @brief Advance fade and dithering; sends at most one register write
+   */
+  void update();
+  
+private:
+  MAX7219Display& _display;
+  uint8_t _level;           // Current perceptual level
+  uint8_t _startLevel;      // Fade start level
+  uint8_t _targetLevel;     // Fade target level
+  uint16_t _fadeMs;         // Fade duration (0 = not fading)
+  unsigned long _fadeStart; // millis() when the fade started
+  uint8_t _error;           // Dither accumulator (1/16 steps)
+  uint8_t _intensity;       // INTENSITY register as last written (0xFF = unknown)
+  uint8_t _on;              // SHUTDOWN state as last written (0xFF = unknown)
+  
+  uint16_t gammaLevel(uint8_t level);
+};
+
+#endif // MAX7219_DIMMER_H
@@ -0,0 +1,137 @@
+/*
+ * MAX7219_LevelMeter.cpp - Segment Bar-Graph Renderer Implementation
+ * 
+ * Implementation file for MAX7219_CH32 library
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include <Arduino.h>
+#include "MAX7219_LevelMeter.h"
+
+// Vertical segment pairs (bit pattern: DP-A-B-C-D-E-F-G)
+#define LEVEL_LEFT_PAIR   0b00000110  // F + E
+#define LEVEL_RIGHT_PAIR  0b00110000  // B + C
+
+// ========================================
+// Constructor
+// ========================================
+MAX7219LevelMeter::MAX7219LevelMeter(MAX7219Display& display, uint16_t maxValue, uint8_t firstColumn, uint8_t width)
+  : _display(display) {
+  _maxValue = (maxValue > 0) ? maxValue : 1;
+  _firstColumn = firstColumn;
+  
+  // Fit the bar inside the display
+  uint8_t available = (firstColumn < display._numDigits) ? display._numDigits - firstColumn : 0;
+  _width = (width == 0 || width > available) ? available : width;
+  _level = 0;
+  _peak = 0;
+  _holdMs = 0;
+  _decayMs = 50;
+  _peakTime = 0;
+}
+
+// ========================================
+// Level Control
+// ========================================
+void MAX7219LevelMeter::setValue(uint16_t value) {
+  uint8_t steps = 2 * _width;
+  if (value > _maxValue) value = _maxValue;
+  uint8_t level = (uint8_t)(((uint32_t)value * steps + _maxValue / 2) / _maxValue);
+  
+  uint8_t oldLevel = _level;
+  _level = level;
+  
+  // Only the digits between the old and new bar ends change
+  if (level > oldLevel) {
+    drawSteps(oldLevel, level);
+  } else if (level < oldLevel) {
+    drawSteps(level, oldLevel);
+  }
+  
+  if (_holdMs > 0 && level >= _peak) {
+    setPeak(level);
+  } else {
+    update();
+  }
+}
+
+void MAX7219LevelMeter::setPeakHold(uint16_t holdMs, uint16_t decayMs) {
+  _holdMs = holdMs;
+  _decayMs = (decayMs > 0) ? decayMs : 1;
+  if (_holdMs == 0) setPeak(0);
+}
+
+void MAX7219LevelMeter::update() {
+  if (_peak <= _level) return;
+  
+  unsigned long now = millis();
+  unsigned long elapsed = now - _peakTime;
+  if (elapsed < _holdMs) return;
+  
+  // Drop one step per decay interval once the hold time has passed; a late
+  // call can owe many steps, so count them in full before clamping
+  unsigned long decaying = elapsed - _holdMs;
+  unsigned long drop = decaying / _decayMs;
+  if (drop == 0) return;
+  
+  uint8_t peak = (drop < (unsigned long)(_peak - _level)) ? _peak - drop : _level;
+  setPeak(peak);
+  _peakTime = now - _holdMs - decaying % _decayMs;  // Keep decaying at the same rate
+}
+
+void MAX7219LevelMeter::redraw() {
+  for (uint8_t i = 0; i < _width; i++) {
+    _display.sendCommand(MAX7219_REG_DIGIT0 + _display._colMap[_firstColumn + i], segmentsFor(i));
+  }
+}
+
+uint8_t MAX7219LevelMeter::getLevel() {
+  return _level;
+}
+
+uint8_t MAX7219LevelMeter::getPeak() {
+  return _peak;
+}
+
+// ========================================
+// Internal Helper Functions
+// ========================================
+uint8_t MAX7219LevelMeter::segmentsFor(uint8_t index) {
+  uint8_t firstStep = 2 * index;  // Steps firstStep+1 and firstStep+2 live here
+  uint8_t segments = 0;
+  
+  if (_level > firstStep) segments |= LEVEL_LEFT_PAIR;
+  if (_level > firstStep + 1) segments |= LEVEL_RIGHT_PAIR;
+  
+  if (_peak > _level) {
+    if (_peak == firstStep + 1) segments |= LEVEL_LEFT_PAIR;
+    if (_peak == firstStep + 2) segments |= LEVEL_RIGHT_PAIR;
+  }
+  return segments;
+}
+
+void MAX7219LevelMeter::drawSteps(uint8_t fromStep, uint8_t toStep) {
+  // Redraw the digits holding steps fromStep+1 .. toStep
+  if (toStep == 0) return;
+  uint8_t first = fromStep / 2;
+  uint8_t last = (toStep - 1) / 2;
+  
+  for (uint8_t i = first; i <= last && i < _width; i++) {
+    _display.writeDigit(_display._colMap[_firstColumn + i], segmentsFor(i));
+  }
+}
+
+void MAX7219LevelMeter::setPeak(uint8_t peak) {
+  uint8_t oldPeak = _peak;
+  _peak = peak;
+  _peakTime = millis();
+  
+  if (peak != oldPeak) {
+    if (oldPeak > 0) drawSteps(oldPeak - 1, oldPeak);
+    if (peak > 0) drawSteps(peak - 1, peak);
+  }
+}
@@ -0,0 +1,91 @@
+/*
+ * MAX7219_LevelMeter.h - Segment Bar-Graph Renderer for MAX7219_CH32
+ * 
+ * Maps a 0..maxValue level onto a horizontal bar across the digits. Each
+ * digit holds two steps (left vertical pair F+E, then right pair B+C), so
+ * an 8-digit display gives 16 steps. Optional peak hold shows the recent
+ * maximum as a single vertical pair that decays after a hold time.
+ * 
+ * Only digits whose fill changed are sent, so updating at 100+ Hz costs
+ * a register write or two per call. Requires MAX7219_MODE_NO_DECODE.
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef MAX7219_LEVELMETER_H
+#define MAX7219_LEVELMETER_H
+
+#include <Arduino.h>
+#include "MAX7219_CH32.h"
+
+// ========================================
+// MAX7219LevelMeter Class
+// ========================================
+/**
+ * @class MAX7219LevelMeter
+ * @brief Incremental bar-graph / level-meter renderer
+ */
+class MAX7219LevelMeter {
+public:
+  /**
+   * @brief Constructor
+   * @param display Display to draw on (must be in MAX7219_MODE_NO_DECODE)
+   * @param maxValue Value that fills the whole bar
+   * @param firstColumn Leftmost digit of the bar (0 = leftmost digit, default: 0)
+   * @param width Number of digits used by the bar (0 = up to the right edge, default: 0)
+   */
+  MAX7219LevelMeter(MAX7219Display& display, uint16_t maxValue, uint8_t firstColumn = 0, uint8_t width = 0);
+  
+  /**
+   * @brief Set the level and redraw the digits that changed
+   * @param value Level (0..maxValue, larger values are clamped)
+   */
+  void setValue(uint16_t value);
+  
+  /**
+   * @brief Configure peak hold
+   * @param holdMs Time the peak stays before decaying (0 = peak hold off)
+   * @param decayMs Time per one-step decay after the hold expires (default: 50)
+   */
+  void setPeakHold(uint16_t holdMs, uint16_t decayMs = 50);
+  
+  /**
+   * @brief Advance the peak decay; call regularly from loop()
+   */
+  void update();
+  
+  /**
+   * @brief Redraw the whole bar (e.g. after clear() or a mode change)
+   */
+  void redraw();
+  
+  /**
+   * @brief Current bar length in steps (0..2 * width)
+   */
+  uint8_t getLevel();
+  
+  /**
+   * @brief Current peak position in steps (0 = no peak shown)
+   */
+  uint8_t getPeak();
+  
+private:
+  MAX7219Display& _display;
+  uint16_t _maxValue;
+  uint8_t _firstColumn;
+  uint8_t _width;
+  uint8_t _level;       // Bar length in steps
+  uint8_t _peak;        // Peak position in steps
+  uint16_t _holdMs;
+  uint16_t _decayMs;
+  unsigned long _peakTime;  // millis() when the peak was set or last decayed
+  
+  uint8_t segmentsFor(uint8_t index);
+  void drawSteps(uint8_t fromStep, uint8_t toStep);
+  void setPeak(uint8_t peak);
+};
+
+#endif // MAX7219_LEVELMETER_H
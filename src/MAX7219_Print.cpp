@@ -0,0 +1,55 @@
+/*
+ * MAX7219_Print.cpp - Print Adapter Implementation
+ * 
+ * Implementation file for MAX7219_CH32 library
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include <Arduino.h>
+#include <string.h>
+#include "MAX7219_Print.h"
+
+// ========================================
+// Constructor
+// ========================================
+MAX7219Print::MAX7219Print(MAX7219Display& display) : _display(display) {
+  _length = 0;
+  _overflow = false;
+}
+
+// ========================================
+// Print Interface
+// ========================================
+size_t MAX7219Print::write(uint8_t c) {
+  if (c == '\n') {
+    // End of line: apply alignment and send. A line that does not fit would
+    // show a wrong value once cut, so it shows dashes instead
+    if (_overflow || _length > _display._numDigits) {
+      _length = _display._numDigits;
+      memset(_line, '-', _length);
+    }
+    _display.displayRowInternal(_line, _length);
+    _length = 0;
+    _overflow = false;
+  } else if (c == '\r') {
+    // Ignored so println() works on every core
+  } else if (c == '.') {
+    // Merge decimal point into the previous digit when possible
+    if (_length > 0 && !(_line[_length - 1] & 0x80)) {
+      _line[_length - 1] |= 0x80;
+    } else if (_length < sizeof(_line)) {
+      _line[_length++] = (char)(' ' | 0x80);
+    } else {
+      _overflow = true;
+    }
+  } else if (_length < sizeof(_line)) {
+    _line[_length++] = (char)(c & 0x7F);
+  } else {
+    _overflow = true;
+  }
+  return 1;
+}
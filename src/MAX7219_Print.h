@@ -0,0 +1,54 @@
+/*
+ * MAX7219_Print.h - Print Adapter for MAX7219_CH32
+ * 
+ * Lets the display be used as an Arduino Print target, so print(value, HEX),
+ * print(float, 2) and friends stream characters straight into the digit
+ * buffer. A decimal point is merged into the preceding digit, and the line
+ * is aligned and sent to the display on '\n' (println). A line longer than
+ * the display shows dashes. In decode mode a line with letters (hex) is
+ * drawn as segment patterns, as displayHex() does.
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef MAX7219_PRINT_H
+#define MAX7219_PRINT_H
+
+#include <Arduino.h>
+#include "MAX7219_CH32.h"
+
+// ========================================
+// MAX7219Print Class
+// ========================================
+/**
+ * @class MAX7219Print
+ * @brief Print adapter that renders each line onto a MAX7219 display
+ */
+class MAX7219Print : public Print {
+public:
+  /**
+   * @brief Constructor
+   * @param display Display to print to
+   */
+  MAX7219Print(MAX7219Display& display);
+  
+  /**
+   * @brief Write one character (called by the Print class)
+   * @param c Character; '\n' shows the line, '\r' is ignored
+   * @return Number of bytes consumed (always 1)
+   */
+  virtual size_t write(uint8_t c);
+  
+  using Print::write;
+  
+private:
+  MAX7219Display& _display;
+  char _line[8];    // One character per digit, bit 7 = decimal point
+  uint8_t _length;
+  bool _overflow;   // Characters were dropped from the current line
+};
+
+#endif // MAX7219_PRINT_H
@@ -0,0 +1,108 @@
+/*
+ * MAX7219_Protocol.cpp - Binary Serial Protocol Implementation
+ * 
+ * Implementation file for MAX7219_CH32 library
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include <Arduino.h>
+#include "MAX7219_Protocol.h"
+
+// ========================================
+// Constructor
+// ========================================
+MAX7219Protocol::MAX7219Protocol(MAX7219Display& display) : _display(display) {
+  reset();
+}
+
+void MAX7219Protocol::reset() {
+  _state = WAIT_SYNC;
+  _command = 0;
+  _length = 0;
+  _index = 0;
+  _value = 0;
+}
+
+// ========================================
+// Parser
+// ========================================
+bool MAX7219Protocol::feed(uint8_t data) {
+  switch (_state) {
+    case WAIT_SYNC:
+      if (data == MAX7219_PROTO_SYNC) _state = WAIT_COMMAND;
+      return false;
+      
+    case WAIT_COMMAND:
+      _command = data;
+      _state = WAIT_LENGTH;
+      return false;
+      
+    case WAIT_LENGTH:
+      _length = data;
+      _index = 0;
+      _value = 0;
+      if (_length == 0) {
+        _state = WAIT_SYNC;  // Empty frame: nothing to apply
+        return true;
+      }
+      _state = WAIT_PAYLOAD;
+      return false;
+      
+    case WAIT_PAYLOAD:
+    default:
+      return handlePayload(data);
+  }
+}
+
+bool MAX7219Protocol::handlePayload(uint8_t data) {
+  uint8_t index = _index++;
+  bool last = (_index >= _length);
+  
+  switch (_command) {
+    case MAX7219_PROTO_SEGMENTS:
+      // Each byte lands on its digit as soon as it arrives, as a segment
+      // pattern even in decode mode
+      if (index < _display._numDigits) {
+        _display.writeRawSegments(_display._posMap[index], data);
+      }
+      break;
+      
+    case MAX7219_PROTO_NUMBER:
+      // Shorter than 4 bytes: malformed, the display is left unchanged
+      if (index < 4) {
+        _value |= (uint32_t)data << (8 * index);
+        if (index == 3 && last) _display.display((long)(int32_t)_value);
+      } else if (index == 4) {
+        _display.displayFixed((long)(int32_t)_value, data);
+      }
+      break;
+      
+    case MAX7219_PROTO_BRIGHTNESS:
+      if (index == 0) _display.setBrightness(data);
+      break;
+      
+    case MAX7219_PROTO_POWER:
+      if (index == 0) _display.setPower(data != 0);
+      break;
+      
+    default:
+      break;  // Unknown command: skip payload
+  }
+  
+  if (last) _state = WAIT_SYNC;
+  return last;
+}
+
+uint8_t MAX7219Protocol::poll(Stream& stream) {
+  uint8_t frames = 0;
+  while (stream.available() > 0) {
+    int data = stream.read();
+    if (data < 0) break;
+    if (feed((uint8_t)data)) frames++;
+  }
+  return frames;
+}
@@ -0,0 +1,95 @@
+/*
+ * MAX7219_Protocol.h - Binary Serial Protocol for MAX7219_CH32
+ * 
+ * Incremental parser for a compact binary frame protocol that lets a host
+ * (PC, test rig) drive the display over any Arduino Stream. Bytes are
+ * consumed one at a time and written straight into the display: no heap,
+ * no line buffer.
+ * 
+ * Frame format:
+ *   0xA5 <command> <length> <payload[length]>
+ * 
+ * Commands:
+ *   0x01 SEGMENTS   - Raw segment bytes, position 0 first (length 1-8); the
+ *                     touched digits leave BCD decoding until overwritten
+ *   0x02 NUMBER     - int32 little-endian, optional 5th byte = decimals (length 4-5,
+ *                     shorter frames are ignored)
+ *   0x03 BRIGHTNESS - Brightness level 0-15 (length 1)
+ *   0x04 POWER      - 0 = off, non-zero = on (length 1)
+ * 
+ * Unknown commands are skipped using their length byte.
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef MAX7219_PROTOCOL_H
+#define MAX7219_PROTOCOL_H
+
+#include <Arduino.h>
+#include "MAX7219_CH32.h"
+
+// ========================================
+// Protocol Constants
+// ========================================
+#define MAX7219_PROTO_SYNC        0xA5  // Start-of-frame marker
+#define MAX7219_PROTO_SEGMENTS    0x01  // Raw segment frame
+#define MAX7219_PROTO_NUMBER      0x02  // Numeric value (int32, optional decimals)
+#define MAX7219_PROTO_BRIGHTNESS  0x03  // Brightness command
+#define MAX7219_PROTO_POWER       0x04  // Power command
+
+// ========================================
+// MAX7219Protocol Class
+// ========================================
+/**
+ * @class MAX7219Protocol
+ * @brief Incremental binary frame parser that drives a MAX7219 display
+ */
+class MAX7219Protocol {
+public:
+  /**
+   * @brief Constructor
+   * @param display Display to drive
+   */
+  MAX7219Protocol(MAX7219Display& display);
+  
+  /**
+   * @brief Process one received byte
+   * @param data Received byte
+   * @return true if this byte completed a frame
+   */
+  bool feed(uint8_t data);
+  
+  /**
+   * @brief Process all bytes currently available on a stream
+   * @param stream Source stream (Serial, SoftwareSerial, ...)
+   * @return Number of frames completed
+   */
+  uint8_t poll(Stream& stream);
+  
+  /**
+   * @brief Drop any partially received frame and wait for the next sync byte
+   */
+  void reset();
+  
+private:
+  enum State : uint8_t {
+    WAIT_SYNC,
+    WAIT_COMMAND,
+    WAIT_LENGTH,
+    WAIT_PAYLOAD
+  };
+  
+  MAX7219Display& _display;
+  State _state;
+  uint8_t _command;
+  uint8_t _length;
+  uint8_t _index;
+  uint32_t _value;  // Accumulator for multi-byte payloads
+  
+  bool handlePayload(uint8_t data);
+};
+
+#endif // MAX7219_PROTOCOL_H
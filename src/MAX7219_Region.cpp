@@ -0,0 +1,123 @@
+/*
+ * MAX7219_Region.cpp - Independently Updated Display Regions Implementation
+ * 
+ * Implementation file for MAX7219_CH32 library
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include <Arduino.h>
+#include "MAX7219_Region.h"
+
+// ========================================
+// Constructor
+// ========================================
+MAX7219Region::MAX7219Region(MAX7219Display& display, uint8_t offset, uint8_t width, uint8_t alignment)
+  : _display(display) {
+  // Fit the region inside the display
+  uint8_t available = (offset < display._numDigits) ? display._numDigits - offset : 0;
+  _offset = offset;
+  _width = (width > available) ? available : width;
+  _alignment = alignment;
+  _decimals = 0;
+  _leadingZeros = false;
+}
+
+// ========================================
+// Configuration
+// ========================================
+void MAX7219Region::setFormat(uint8_t decimals, bool leadingZeros) {
+  _decimals = decimals;
+  _leadingZeros = leadingZeros;
+}
+
+void MAX7219Region::setAlignment(uint8_t alignment) {
+  _alignment = alignment;
+}
+
+// ========================================
+// Rendering
+// ========================================
+void MAX7219Region::show(long value) {
+  // Characters are built right to left; bit 7 marks the decimal point
+  char line[8];
+  uint8_t count = 0;
+  bool negative = value < 0;
+  unsigned long magnitude = negative ? 0UL - (unsigned long)value : (unsigned long)value;
+  // Always a digit before the decimal point; zero padding may add more
+  uint8_t minDigits = _decimals + 1;
+  if (_leadingZeros && _width - (negative ? 1 : 0) > minDigits) {
+    minDigits = _width - (negative ? 1 : 0);
+  }
+  
+  do {
+    if (count >= _width) {
+      // Does not fit: show dashes across the region
+      memset(line, '-', _width);
+      render(line, _width);
+      return;
+    }
+    char c = '0' + (magnitude % 10);
+    if (_decimals > 0 && count == _decimals) c |= 0x80;
+    line[7 - count++] = c;
+    magnitude /= 10;
+  } while (magnitude > 0 || count < minDigits);
+  
+  if (negative) {
+    if (count >= _width) {
+      memset(line, '-', _width);
+      render(line, _width);
+      return;
+    }
+    line[7 - count++] = '-';
+  }
+  
+  render(line + 8 - count, count);
+}
+
+void MAX7219Region::show(const char* text) {
+  char line[8];
+  uint8_t count = 0;
+  
+  for (; *text; text++) {
+    if (*text == '.' && count > 0 && !(line[count - 1] & 0x80)) {
+      line[count - 1] |= 0x80;  // Merge decimal point into the previous digit
+    } else if (count < _width) {
+      line[count++] = (*text == '.') ? (char)(' ' | 0x80) : (char)(*text & 0x7F);
+    } else {
+      break;
+    }
+  }
+  render(line, count);
+}
+
+void MAX7219Region::clear() {
+  render(0, 0);
+}
+
+void MAX7219Region::render(const char* chars, uint8_t count) {
+  // Position of the content inside the region
+  uint8_t start;
+  if (_alignment == MAX7219_ALIGN_LEFT) {
+    start = 0;
+  } else if (_alignment == MAX7219_ALIGN_CENTER) {
+    start = (_width - count) / 2;
+  } else {  // RIGHT
+    start = _width - count;
+  }
+  
+  // Only this region's digits are touched, and only if they changed
+  for (uint8_t i = 0; i < _width; i++) {
+    uint8_t data;
+    if (i >= start && i < start + count) {
+      char c = chars[i - start];
+      data = _display.encodeChar((char)(c & 0x7F), (c & 0x80) != 0);
+    } else {
+      data = _display.encodeChar(' ', false);
+    }
+    _display.writeDigit(_display._colMap[_offset + i], data);
+  }
+}
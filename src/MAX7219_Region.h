@@ -0,0 +1,80 @@
+/*
+ * MAX7219_Region.h - Independently Updated Display Regions for MAX7219_CH32
+ * 
+ * A region is a named field of the display with its own offset, width,
+ * alignment and number format, e.g. a 2-digit label next to a 5-digit
+ * reading. Updating a region renders only its digits and sends only the
+ * ones that changed; the rest of the display is left untouched.
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef MAX7219_REGION_H
+#define MAX7219_REGION_H
+
+#include <Arduino.h>
+#include "MAX7219_CH32.h"
+
+// ========================================
+// MAX7219Region Class
+// ========================================
+/**
+ * @class MAX7219Region
+ * @brief Field of consecutive digits rendered independently of the others
+ */
+class MAX7219Region {
+public:
+  /**
+   * @brief Constructor
+   * @param display Display the region belongs to
+   * @param offset First digit of the region (0 = leftmost digit)
+   * @param width Number of digits in the region
+   * @param alignment Alignment inside the region (default: MAX7219_ALIGN_RIGHT)
+   */
+  MAX7219Region(MAX7219Display& display, uint8_t offset, uint8_t width, uint8_t alignment = MAX7219_ALIGN_RIGHT);
+  
+  /**
+   * @brief Set number format
+   * @param decimals Decimal places for show(long) (value is scaled, e.g. 1234 with 2 shows 12.34)
+   * @param leadingZeros true to pad numbers with zeros to the region width (default: false)
+   */
+  void setFormat(uint8_t decimals, bool leadingZeros = false);
+  
+  /**
+   * @brief Set alignment inside the region
+   * @param alignment MAX7219_ALIGN_LEFT, MAX7219_ALIGN_RIGHT or MAX7219_ALIGN_CENTER
+   */
+  void setAlignment(uint8_t alignment);
+  
+  /**
+   * @brief Show a number using the region format (dashes if it does not fit)
+   * @param value Value to display
+   */
+  void show(long value);
+  
+  /**
+   * @brief Show text; '.' is merged into the previous character
+   * @param text Text to display (truncated to the region width)
+   */
+  void show(const char* text);
+  
+  /**
+   * @brief Blank the region
+   */
+  void clear();
+  
+private:
+  MAX7219Display& _display;
+  uint8_t _offset;
+  uint8_t _width;
+  uint8_t _alignment;
+  uint8_t _decimals;
+  bool _leadingZeros;
+  
+  void render(const char* chars, uint8_t count);
+};
+
+#endif // MAX7219_REGION_H
@@ -0,0 +1,71 @@
+/*
+ * MAX7219_SPI.h - Hardware SPI Transport for MAX7219_CH32
+ * 
+ * Header-only so the SPI library is only linked into sketches that
+ * include this file.
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef MAX7219_SPI_H
+#define MAX7219_SPI_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "MAX7219_Transport.h"
+
+// Default SPI clock (the MAX7219 accepts up to 10 MHz)
+#ifndef MAX7219_SPI_CLOCK_HZ
+#define MAX7219_SPI_CLOCK_HZ 10000000UL
+#endif
+
+// ========================================
+// MAX7219HardwareSPI Class
+// ========================================
+/**
+ * @class MAX7219HardwareSPI
+ * @brief Transport using the hardware SPI peripheral (DIN = MOSI, CLK = SCK)
+ */
+class MAX7219HardwareSPI : public MAX7219Transport {
+public:
+  /**
+   * @brief Constructor
+   * @param csPin Chip select pin (CS/SS)
+   * @param spi SPI bus to use (default: SPI)
+   * @param clockHz SPI clock frequency (default: MAX7219_SPI_CLOCK_HZ)
+   */
+  MAX7219HardwareSPI(uint8_t csPin, SPIClass& spi = SPI, uint32_t clockHz = MAX7219_SPI_CLOCK_HZ)
+    : _spi(spi), _settings(clockHz, MSBFIRST, SPI_MODE0), _csPin(csPin) {
+  }
+  
+  virtual void begin() {
+    pinMode(_csPin, OUTPUT);
+    digitalWrite(_csPin, HIGH);
+    _spi.begin();
+  }
+  
+  virtual void select() {
+    _spi.beginTransaction(_settings);
+    digitalWrite(_csPin, LOW);
+  }
+  
+  virtual void transfer(uint8_t address, uint8_t data) {
+    _spi.transfer(address);
+    _spi.transfer(data);
+  }
+  
+  virtual void latch() {
+    digitalWrite(_csPin, HIGH);
+    _spi.endTransaction();
+  }
+  
+private:
+  SPIClass& _spi;
+  SPISettings _settings;
+  uint8_t _csPin;
+};
+
+#endif // MAX7219_SPI_H
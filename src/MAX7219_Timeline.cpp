@@ -0,0 +1,236 @@
+/*
+ * MAX7219_Timeline.cpp - Non-Blocking Display Sequencer Implementation
+ *
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include "MAX7219_Timeline.h"
+
+// ========================================
+// Constructor
+// ========================================
+MAX7219Timeline::MAX7219Timeline(MAX7219Display& display)
+  : _display(display) {
+  _steps = 0;
+  _count = 0;
+  _index = 0;
+  _next = 0;
+  _phase = 0;
+  _running = false;
+  _holding = false;
+  _holdStart = 0;
+  _onSchedule = false;
+  _holdMs = 0;
+  _savedBrightness = 0;
+  _loopDepth = 0;
+}
+
+// ========================================
+// Public Functions
+// ========================================
+void MAX7219Timeline::start(const MAX7219Step* steps, uint8_t count) {
+  if (_running) interrupt();
+  _steps = steps;
+  _count = count;
+  _index = 0;
+  _phase = 0;
+  _holding = false;
+  _onSchedule = false;
+  _loopDepth = 0;
+  _running = (steps != 0 && count > 0);
+}
+
+void MAX7219Timeline::cancel() {
+  if (!_running) return;
+  interrupt();
+  _running = false;
+}
+
+void MAX7219Timeline::jump(uint8_t step) {
+  if (!_running) return;
+  interrupt();
+  leaveLoops(step);
+  _index = step;
+  _phase = 0;
+  _holding = false;
+  _onSchedule = false;
+  if (_index >= _count) _running = false;
+}
+
+bool MAX7219Timeline::isRunning() {
+  return _running;
+}
+
+uint8_t MAX7219Timeline::getStep() {
+  return _index;
+}
+
+void MAX7219Timeline::update() {
+  // Bounds the steps run in one call, so a table of zero-length steps that
+  // loops forever cannot stall loop()
+  uint8_t budget = _count;
+
+  while (_running) {
+    if (_holding) {
+      if (millis() - _holdStart < _holdMs) return;
+      _holding = false;
+      _onSchedule = true;
+    }
+
+    const MAX7219Step& step = _steps[_index];
+    if (_phase == 0) _next = _index + 1;
+
+    if (runPhase(step)) {
+      // Frame shown: hold it before the next phase
+      _phase++;
+      _holding = true;
+      holdFrom(step.ms);
+      continue;
+    }
+
+    // Step finished
+    _index = _next;
+    _phase = 0;
+    if (_index >= _count) _running = false;
+    if (--budget == 0) return;
+  }
+}
+
+// ========================================
+// Private Functions
+// ========================================
+bool MAX7219Timeline::runPhase(const MAX7219Step& step) {
+  // Runs one frame of the step; returns false once the step is complete
+  switch (step.action) {
+    case MAX7219_STEP_NUMBER:
+      if (_phase > 0) return false;
+      _display.display(step.value);
+      return true;
+
+#ifndef MAX7219_NO_TEXT
+    case MAX7219_STEP_TEXT:
+      if (_phase > 0) return false;
+      _display.display(step.text);
+      return true;
+#endif
+
+    case MAX7219_STEP_CLEAR:
+      if (_phase > 0) return false;
+      _display.clear();
+      return true;
+
+    case MAX7219_STEP_BRIGHTNESS:
+      if (_phase > 0) return false;
+      _display.setBrightness(step.value);
+      return true;
+
+    case MAX7219_STEP_WAIT:
+      return _phase == 0;
+
+    case MAX7219_STEP_BLINK:
+      // Off on even phases, on on odd phases
+      if (_phase >= 2 * step.value) return false;
+      _display.setPower(_phase & 1);
+      return true;
+
+    case MAX7219_STEP_FADE_IN:
+      if (_phase == 0) _savedBrightness = _display._brightness;
+      if (_phase > 15) {
+        _display.setBrightness(_savedBrightness);
+        return false;
+      }
+      _display.setBrightness(_phase);
+      return true;
+
+    case MAX7219_STEP_FADE_OUT:
+      if (_phase == 0) _savedBrightness = _display._brightness;
+      if (_phase > _savedBrightness) {
+        _display.setBrightness(_savedBrightness);
+        return false;
+      }
+      _display.setBrightness(_savedBrightness - _phase);
+      return true;
+
+#ifndef MAX7219_NO_TEXT
+    case MAX7219_STEP_SCROLL: {
+      // Text enters on the right and leaves on the left, one digit per phase
+      int len = strlen(step.text);
+      if (_phase > _display._numDigits - 1 + len) return false;
+      _display.scrollFrame(step.text, len, _display._numDigits - 1 - _phase);
+      return true;
+    }
+#endif
+
+    case MAX7219_STEP_LOOP:
+      loopStep(step);
+      return false;
+
+    case MAX7219_STEP_JUMP:
+      leaveLoops(step.value);
+      _next = step.value;
+      return false;
+
+    case MAX7219_STEP_END:
+      _next = _count;
+      return false;
+  }
+  return false;  // Unknown or compiled-out action: skip it
+}
+
+void MAX7219Timeline::holdFrom(uint16_t ms) {
+  // Start the hold where the previous one was due to end, so a late update()
+  // does not shift the rest of the show. A timeline that fell behind by a
+  // whole hold picks up from now instead of rushing through frames
+  unsigned long now = millis();
+  unsigned long due = _holdStart + _holdMs;
+  if (_onSchedule && now - due <= ms) {
+    _holdStart = due;
+  } else {
+    _holdStart = now;
+  }
+  _holdMs = ms;
+}
+
+void MAX7219Timeline::loopStep(const MAX7219Step& step) {
+  uint8_t top = _loopDepth - 1;
+  if (_loopDepth > 0 && _loopStep[top] == _index) {
+    // Returning to an active loop: count down the remaining passes
+    if (--_loopLeft[top] > 0) {
+      _next = step.value;
+    } else {
+      _loopDepth--;
+    }
+  } else if (step.ms == 0) {
+    _next = step.value;  // Forever
+  } else if (step.ms > 1 && _loopDepth < MAX7219_TIMELINE_MAX_LOOPS) {
+    // First arrival: the body has already played once
+    _loopStep[_loopDepth] = _index;
+    _loopLeft[_loopDepth] = step.ms - 1;
+    _loopDepth++;
+    _next = step.value;
+  }
+  // One pass, or nested too deeply: continue after the loop
+}
+
+void MAX7219Timeline::leaveLoops(uint8_t step) {
+  // Forget loops whose body (target step to LOOP step) does not contain the destination
+  while (_loopDepth > 0) {
+    uint8_t loopIndex = _loopStep[_loopDepth - 1];
+    if (step >= _steps[loopIndex].value && step <= loopIndex) break;
+    _loopDepth--;
+  }
+}
+
+void MAX7219Timeline::interrupt() {
+  // Leave the display usable when a blink or fade is cut short
+  if (_phase == 0 || _index >= _count) return;
+  uint8_t action = _steps[_index].action;
+  if (action == MAX7219_STEP_BLINK) {
+    _display.setPower(true);
+  } else if (action == MAX7219_STEP_FADE_IN || action == MAX7219_STEP_FADE_OUT) {
+    _display.setBrightness(_savedBrightness);
+  }
+}
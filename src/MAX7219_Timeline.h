@@ -0,0 +1,154 @@
+/*
+ * MAX7219_Timeline.h - Non-Blocking Display Sequencer for MAX7219_CH32
+ *
+ * A timeline plays a static table of steps (show a number or text, blink,
+ * fade, scroll, wait...) one step at a time from update(), so loop() keeps
+ * running while a show plays. LOOP and JUMP steps repeat or skip parts of
+ * the table; cancel() stops it at any point. The table is const and can be
+ * shared by several timelines; each timeline uses a fixed amount of RAM
+ * (set by MAX7219_TIMELINE_MAX_LOOPS).
+ *
+ *   const MAX7219Step intro[] = {
+ *     MAX7219_SHOW_TEXT("HELLO", 1000),
+ *     MAX7219_BLINK(3, 250),
+ *     MAX7219_SHOW_NUMBER(1234, 1000),
+ *     MAX7219_LOOP(0, 2),               // Play the steps above twice
+ *     MAX7219_FADE_OUT(50),
+ *     MAX7219_END()
+ *   };
+ *
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef MAX7219_TIMELINE_H
+#define MAX7219_TIMELINE_H
+
+#include <Arduino.h>
+#include "MAX7219_CH32.h"
+
+// Maximum number of LOOP steps active at the same time (nesting depth)
+#ifndef MAX7219_TIMELINE_MAX_LOOPS
+#define MAX7219_TIMELINE_MAX_LOOPS 4
+#endif
+
+// ========================================
+// Step Actions
+// ========================================
+#define MAX7219_STEP_END         0   // Stop the timeline
+#define MAX7219_STEP_NUMBER      1   // display(value), then hold
+#define MAX7219_STEP_TEXT        2   // display(text), then hold
+#define MAX7219_STEP_CLEAR       3   // clear(), then hold
+#define MAX7219_STEP_BRIGHTNESS  4   // setBrightness(value), then hold
+#define MAX7219_STEP_WAIT        5   // Hold only
+#define MAX7219_STEP_BLINK       6   // Blink 'value' times, 'ms' off and on
+#define MAX7219_STEP_FADE_IN     7   // Like fadeIn(), 'ms' per level
+#define MAX7219_STEP_FADE_OUT    8   // Like fadeOut(), 'ms' per level
+#define MAX7219_STEP_SCROLL      9   // Like scroll(text), 'ms' per shift
+#define MAX7219_STEP_LOOP        10  // Go back to step 'value'; 'ms' = total passes (0 = forever)
+#define MAX7219_STEP_JUMP        11  // Continue at step 'value'
+
+// ========================================
+// Step Table Helpers
+// ========================================
+#define MAX7219_SHOW_NUMBER(n, holdMs)  { MAX7219_STEP_NUMBER, (long)(n), 0, (holdMs) }
+#define MAX7219_SHOW_TEXT(t, holdMs)    { MAX7219_STEP_TEXT, 0, (t), (holdMs) }
+#define MAX7219_CLEAR(holdMs)           { MAX7219_STEP_CLEAR, 0, 0, (holdMs) }
+#define MAX7219_SET_BRIGHTNESS(level)   { MAX7219_STEP_BRIGHTNESS, (level), 0, 0 }
+#define MAX7219_WAIT(ms)                { MAX7219_STEP_WAIT, 0, 0, (ms) }
+#define MAX7219_BLINK(times, ms)        { MAX7219_STEP_BLINK, (times), 0, (ms) }
+#define MAX7219_FADE_IN(ms)             { MAX7219_STEP_FADE_IN, 0, 0, (ms) }
+#define MAX7219_FADE_OUT(ms)            { MAX7219_STEP_FADE_OUT, 0, 0, (ms) }
+#define MAX7219_SCROLL(t, ms)           { MAX7219_STEP_SCROLL, 0, (t), (ms) }
+#define MAX7219_LOOP(toStep, passes)    { MAX7219_STEP_LOOP, (toStep), 0, (passes) }
+#define MAX7219_JUMP(toStep)            { MAX7219_STEP_JUMP, (toStep), 0, 0 }
+#define MAX7219_END()                   { MAX7219_STEP_END, 0, 0, 0 }
+
+/**
+ * @struct MAX7219Step
+ * @brief One entry of a timeline table (see the MAX7219_SHOW_NUMBER()... helpers)
+ */
+struct MAX7219Step {
+  uint8_t action;    // MAX7219_STEP_*
+  long value;        // Number, brightness, blink count or target step
+  const char* text;  // Text for TEXT and SCROLL steps
+  uint16_t ms;       // Hold / per-frame time, or pass count for LOOP
+};
+
+// ========================================
+// MAX7219Timeline Class
+// ========================================
+/**
+ * @class MAX7219Timeline
+ * @brief Plays a table of display steps without blocking
+ */
+class MAX7219Timeline {
+public:
+  /**
+   * @brief Constructor
+   * @param display Display to drive
+   */
+  MAX7219Timeline(MAX7219Display& display);
+
+  /**
+   * @brief Start playing a step table from its first step
+   * @param steps Step table (must stay valid while playing)
+   * @param count Number of steps in the table
+   */
+  void start(const MAX7219Step* steps, uint8_t count);
+
+  /**
+   * @brief Stop playing; an interrupted blink or fade restores power and brightness
+   */
+  void cancel();
+
+  /**
+   * @brief Continue at another step, e.g. on a button press
+   * @param step Step index (past the end stops the timeline)
+   */
+  void jump(uint8_t step);
+
+  /**
+   * @brief Check if the timeline is playing
+   */
+  bool isRunning();
+
+  /**
+   * @brief Get index of the step being played
+   */
+  uint8_t getStep();
+
+  /**
+   * @brief Advance the timeline; call regularly from loop()
+   */
+  void update();
+
+private:
+  MAX7219Display& _display;
+  const MAX7219Step* _steps;
+  uint8_t _count;
+  uint8_t _index;            // Step being played
+  uint8_t _next;             // Step to continue with when this one ends
+  uint16_t _phase;           // Frame within the step (blink, fade, scroll)
+  bool _running;
+  bool _holding;
+  unsigned long _holdStart;  // millis() when the current hold started
+  bool _onSchedule;          // The next hold starts where the last one ended
+  uint16_t _holdMs;
+  uint8_t _savedBrightness;  // Restored after fades
+
+  // Active LOOP steps, innermost last
+  uint8_t _loopStep[MAX7219_TIMELINE_MAX_LOOPS];
+  uint16_t _loopLeft[MAX7219_TIMELINE_MAX_LOOPS];
+  uint8_t _loopDepth;
+
+  bool runPhase(const MAX7219Step& step);
+  void holdFrom(uint16_t ms);
+  void loopStep(const MAX7219Step& step);
+  void leaveLoops(uint8_t step);
+  void interrupt();
+};
+
+#endif // MAX7219_TIMELINE_H
@@ -0,0 +1,201 @@
+/*
+ * MAX7219_Transport.cpp - Bus Transports Implementation
+ * 
+ * Implementation file for MAX7219_CH32 library
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#include <Arduino.h>
+#include <string.h>
+#include "MAX7219_Transport.h"
+
+#if MAX7219_FAST_GPIO
+#if MAX7219_GPIO_SET_RESET
+// Set/reset register, the 32-bit word after the output register
+#define MAX7219_PIN_WRITE(reg, mask, high) \
+  (*((volatile uint32_t*)(reg) + 1) = (high) ? (uint32_t)(mask) : (uint32_t)(mask) << 16)
+#else
+#define MAX7219_PIN_WRITE(reg, mask, high) do { \
+    uint8_t oldSREG = SREG; \
+    cli(); \
+    if (high) *(reg) |= (mask); else *(reg) &= ~(mask); \
+    SREG = oldSREG; \
+  } while (0)
+#endif
+#endif
+
+// ========================================
+// MAX7219BitBang
+// ========================================
+MAX7219BitBang::MAX7219BitBang(uint8_t dinPin, uint8_t clkPin, uint8_t csPin) {
+  _dinPin = dinPin;
+  _clkPin = clkPin;
+  _csPin = csPin;
+  _halfPeriodUs = MAX7219_CLOCK_HALF_PERIOD_US;
+}
+
+void MAX7219BitBang::begin() {
+  pinMode(_dinPin, OUTPUT);
+  pinMode(_clkPin, OUTPUT);
+  pinMode(_csPin, OUTPUT);
+  
+#if MAX7219_FAST_GPIO
+  _dinReg = portOutputRegister(digitalPinToPort(_dinPin));
+  _clkReg = portOutputRegister(digitalPinToPort(_clkPin));
+  _csReg = portOutputRegister(digitalPinToPort(_csPin));
+  _dinMask = digitalPinToBitMask(_dinPin);
+  _clkMask = digitalPinToBitMask(_clkPin);
+  _csMask = digitalPinToBitMask(_csPin);
+#endif
+  
+  writeCs(HIGH);
+  writeClk(LOW);
+  writeDin(LOW);
+}
+
+void MAX7219BitBang::setClockHalfPeriod(uint8_t microseconds) {
+  _halfPeriodUs = microseconds;
+}
+
+void MAX7219BitBang::select() {
+  writeCs(LOW);
+}
+
+void MAX7219BitBang::transfer(uint8_t address, uint8_t data) {
+  // Address and data go out as one 16-bit word, MSB first
+  uint16_t word = ((uint16_t)address << 8) | data;
+  
+#if MAX7219_FAST_GPIO && !defined(MAX7219_MINIMAL) && defined(__GNUC__) && (__GNUC__ >= 8)
+  // Only worth it when a pin write is a single store; unrolling the
+  // digitalWrite() calls would just grow the code. MAX7219_MINIMAL keeps
+  // the loop: the unrolled copy is the largest function of a minimal build
+#pragma GCC unroll 16
+#endif
+  for (uint8_t i = 0; i < 16; i++) {
+    writeDin(word & 0x8000);
+    clockPause();
+    writeClk(HIGH);
+    clockPause();
+    writeClk(LOW);
+    word <<= 1;
+  }
+}
+
+void MAX7219BitBang::latch() {
+  writeCs(HIGH);
+  clockPause();
+}
+
+void MAX7219BitBang::idle() {
+  // CS stays high (deselected); DIN and CLK low so no current flows into
+  // the chip's inputs or external pull-downs
+  writeCs(HIGH);
+  writeClk(LOW);
+  writeDin(LOW);
+}
+
+inline void MAX7219BitBang::writeDin(bool high) {
+#if MAX7219_FAST_GPIO
+  MAX7219_PIN_WRITE(_dinReg, _dinMask, high);
+#else
+  digitalWrite(_dinPin, high ? HIGH : LOW);
+#endif
+}
+
+inline void MAX7219BitBang::writeClk(bool high) {
+#if MAX7219_FAST_GPIO
+  MAX7219_PIN_WRITE(_clkReg, _clkMask, high);
+#else
+  digitalWrite(_clkPin, high ? HIGH : LOW);
+#endif
+}
+
+inline void MAX7219BitBang::writeCs(bool high) {
+#if MAX7219_FAST_GPIO
+  MAX7219_PIN_WRITE(_csReg, _csMask, high);
+#else
+  digitalWrite(_csPin, high ? HIGH : LOW);
+#endif
+}
+
+inline void MAX7219BitBang::clockPause() {
+  if (_halfPeriodUs) {
+    delayMicroseconds(_halfPeriodUs);
+    return;
+  }
+#if MAX7219_FAST_GPIO
+  for (uint8_t i = 0; i < MAX7219_EDGE_CYCLES; i++) {
+    __asm__ __volatile__("nop");
+  }
+#endif
+}
+
+// ========================================
+// MAX7219MockTransport
+// ========================================
+MAX7219MockTransport::MAX7219MockTransport() {
+  memset(_registers, 0, sizeof(_registers));
+  _hasPending = false;
+  clearLog();
+}
+
+void MAX7219MockTransport::begin() {
+}
+
+void MAX7219MockTransport::select() {
+  _hasPending = false;
+}
+
+void MAX7219MockTransport::transfer(uint8_t address, uint8_t data) {
+  uint16_t word = ((uint16_t)address << 8) | data;
+  if (_count < MAX7219_MOCK_CAPACITY) {
+    _log[_count++] = word;
+  } else {
+    _overflow = true;
+  }
+  _pending = word;
+  _hasPending = true;
+}
+
+void MAX7219MockTransport::latch() {
+  _latches++;
+  // The first chip holds the last word shifted before CS rises
+  if (_hasPending) {
+    _registers[(_pending >> 8) & 0x0F] = _pending & 0xFF;
+    _hasPending = false;
+  }
+}
+
+uint16_t MAX7219MockTransport::count() {
+  return _count;
+}
+
+uint8_t MAX7219MockTransport::address(uint16_t index) {
+  return (index < _count) ? (_log[index] >> 8) : 0;
+}
+
+uint8_t MAX7219MockTransport::data(uint16_t index) {
+  return (index < _count) ? (_log[index] & 0xFF) : 0;
+}
+
+uint16_t MAX7219MockTransport::latches() {
+  return _latches;
+}
+
+uint8_t MAX7219MockTransport::registerValue(uint8_t address) {
+  return _registers[address & 0x0F];
+}
+
+bool MAX7219MockTransport::overflowed() {
+  return _overflow;
+}
+
+void MAX7219MockTransport::clearLog() {
+  _count = 0;
+  _latches = 0;
+  _overflow = false;
+}
@@ -0,0 +1,238 @@
+/*
+ * MAX7219_Transport.h - Bus Transports for MAX7219_CH32
+ * 
+ * The display class formats digits and manages registers; a transport moves
+ * the resulting (address, data) pairs onto a bus. Provided transports:
+ * - MAX7219BitBang:       Software SPI on any three pins (default)
+ * - MAX7219HardwareSPI:   Hardware SPI peripheral (include MAX7219_SPI.h)
+ * - MAX7219MockTransport: Records register traffic for testing, no GPIO
+ * 
+ * Author: Rithik Krisna M
+ * License: MIT License
+ * Version: 1.0.0
+ * Created: 2025
+ */
+
+#ifndef MAX7219_TRANSPORT_H
+#define MAX7219_TRANSPORT_H
+
+#include <Arduino.h>
+
+// ========================================
+// Bus Timing
+// ========================================
+// Minimum CLK half-period in microseconds (0 = run the bus as fast as the
+// 50 ns CLK high/low minimum of the MAX7219 allows).
+#ifndef MAX7219_CLOCK_HALF_PERIOD_US
+#define MAX7219_CLOCK_HALF_PERIOD_US  0
+#endif
+
+// Direct port register access, used only where a pin can be written without
+// a read-modify-write race against interrupts touching the same port:
+// - STM32 / CH32: the set/reset register (BSRR / BSHR) follows the output
+//   register; low half sets pins, high half resets them, in one store
+// - AVR: the port update runs with interrupts masked, like digitalWrite()
+// Other cores use digitalWrite(). Define MAX7219_NO_FAST_GPIO to force it.
+#if defined(portOutputRegister) && defined(digitalPinToPort) && \
+    defined(digitalPinToBitMask) && !defined(MAX7219_NO_FAST_GPIO)
+#if defined(ARDUINO_ARCH_STM32) || defined(ARDUINO_ARCH_CH32) || defined(ARDUINO_ARCH_CH32V)
+#define MAX7219_FAST_GPIO 1
+#define MAX7219_GPIO_SET_RESET 1
+#elif defined(__AVR__)
+#define MAX7219_FAST_GPIO 1
+#define MAX7219_GPIO_SET_RESET 0
+#endif
+#endif
+
+#ifndef MAX7219_FAST_GPIO
+#define MAX7219_FAST_GPIO 0
+#endif
+
+#if MAX7219_FAST_GPIO
+typedef decltype(portOutputRegister(digitalPinToPort(0))) MAX7219_PortReg;
+typedef decltype(digitalPinToBitMask(0)) MAX7219_PortMask;
+
+// Direct writes can come one or two cycles apart, so each CLK edge is held
+// for at least 50 ns: one NOP per 20 MHz of CPU clock, rounded up
+#ifndef MAX7219_EDGE_CYCLES
+#ifdef F_CPU
+#define MAX7219_EDGE_CYCLES  ((F_CPU + 19999999UL) / 20000000UL)
+#else
+#define MAX7219_EDGE_CYCLES  4
+#endif
+#endif
+#endif
+
+// Number of register writes the mock transport can record
+#ifndef MAX7219_MOCK_CAPACITY
+#define MAX7219_MOCK_CAPACITY 64
+#endif
+
+// ========================================
+// MAX7219Transport Interface
+// ========================================
+/**
+ * @class MAX7219Transport
+ * @brief Moves (address, data) pairs to one or more chained MAX7219 chips
+ * 
+ * A register update is select(), one transfer() per chip in the chain,
+ * then latch(). The chips load the shifted words on the rising edge of CS.
+ */
+class MAX7219Transport {
+public:
+  /**
+   * @brief Configure the bus pins/peripheral
+   */
+  virtual void begin() = 0;
+  
+  /**
+   * @brief Start a write window (CS low)
+   */
+  virtual void select() = 0;
+  
+  /**
+   * @brief Shift one 16-bit address/data word
+   * @param address Register address
+   * @param data Register data
+   */
+  virtual void transfer(uint8_t address, uint8_t data) = 0;
+  
+  /**
+   * @brief End the write window and latch the shifted words (CS high)
+   */
+  virtual void latch() = 0;
+  
+  /**
+   * @brief Park the bus lines in their lowest-leakage state while the display sleeps
+   */
+  virtual void idle() {}
+  
+#ifdef MAX7219_ENABLE_STATS
+  /**
+   * @brief Bits shifted on the bus by the last latch() (one 16-bit word by default)
+   */
+  virtual uint16_t windowBits() { return 16; }
+#endif
+};
+
+// ========================================
+// MAX7219BitBang Class
+// ========================================
+/**
+ * @class MAX7219BitBang
+ * @brief Software SPI transport on any three digital pins
+ */
+class MAX7219BitBang : public MAX7219Transport {
+public:
+  /**
+   * @brief Constructor
+   * @param dinPin Data input pin (MOSI)
+   * @param clkPin Clock pin (SCK)
+   * @param csPin Chip select pin (CS/SS)
+   */
+  MAX7219BitBang(uint8_t dinPin, uint8_t clkPin, uint8_t csPin);
+  
+  virtual void begin();
+  virtual void select();
+  virtual void transfer(uint8_t address, uint8_t data);
+  virtual void latch();
+  virtual void idle();
+  
+  /**
+   * @brief Set minimum CLK half-period
+   * @param microseconds Delay after each clock edge (0 = no delay, fastest)
+   */
+  void setClockHalfPeriod(uint8_t microseconds);
+  
+private:
+  // Pin configuration
+  uint8_t _dinPin;
+  uint8_t _clkPin;
+  uint8_t _csPin;
+  uint8_t _halfPeriodUs;
+  
+#if MAX7219_FAST_GPIO
+  // Cached port registers for direct pin writes
+  MAX7219_PortReg _dinReg;
+  MAX7219_PortReg _clkReg;
+  MAX7219_PortReg _csReg;
+  MAX7219_PortMask _dinMask;
+  MAX7219_PortMask _clkMask;
+  MAX7219_PortMask _csMask;
+#endif
+  
+  void writeDin(bool high);
+  void writeClk(bool high);
+  void writeCs(bool high);
+  void clockPause();
+};
+
+// ========================================
+// MAX7219MockTransport Class
+// ========================================
+/**
+ * @class MAX7219MockTransport
+ * @brief Records register traffic instead of driving pins
+ * 
+ * Captures every (address, data) pair and CS latch so tests can assert the
+ * exact register sequence produced by display(), displayHex(), animations...
+ * It also mirrors the last value latched into each register.
+ */
+class MAX7219MockTransport : public MAX7219Transport {
+public:
+  MAX7219MockTransport();
+  
+  virtual void begin();
+  virtual void select();
+  virtual void transfer(uint8_t address, uint8_t data);
+  virtual void latch();
+  
+  /**
+   * @brief Number of recorded writes
+   */
+  uint16_t count();
+  
+  /**
+   * @brief Register address of a recorded write
+   * @param index Write index (0 = oldest)
+   */
+  uint8_t address(uint16_t index);
+  
+  /**
+   * @brief Register data of a recorded write
+   * @param index Write index (0 = oldest)
+   */
+  uint8_t data(uint16_t index);
+  
+  /**
+   * @brief Number of CS latch pulses
+   */
+  uint16_t latches();
+  
+  /**
+   * @brief Last value latched into a register of the first chip
+   * @param address Register address (0x00-0x0F)
+   */
+  uint8_t registerValue(uint8_t address);
+  
+  /**
+   * @brief true if more writes arrived than MAX7219_MOCK_CAPACITY
+   */
+  bool overflowed();
+  
+  /**
+   * @brief Forget recorded writes and latches (register mirror is kept)
+   */
+  void clearLog();
+  
+private:
+  uint16_t _log[MAX7219_MOCK_CAPACITY];  // (address << 8) | data
+  uint16_t _count;
+  uint16_t _latches;
+  bool _overflow;
+  uint16_t _pending;   // Last word shifted in the current window
+  bool _hasPending;
+  uint8_t _registers[16];
+};
+
+#endif // MAX7219_TRANSPORT_H